@@ -0,0 +1,774 @@
+#ifndef ALGORITMOS_H
+#define ALGORITMOS_H
+
+#include <vector>
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <functional>
+#include <random>
+#include <cstdio>
+#include <atomic>
+#include <filesystem>
+#include "benchmark.h"
+#include "../Ordenamiento/ordenamiento.h"
+#include "../Ordenamiento/seleccion_k.h"
+#include "../Ordenamiento/ordenamiento_paralelo.h"
+#include "../Multiplicacion_de_Matrices/matrices.h"
+#include "../Multiplicacion_de_Matrices/gemm_estrecho.h"
+#include "../Multiplicacion_de_Matrices/dispersa.h"
+#include "../Multiplicacion_de_Matrices/lotes.h"
+#include "../Multiplicacion_de_Matrices/cadena.h"
+#include "../Multiplicacion_de_Matrices/transpuesta.h"
+#include "../Multiplicacion_de_Matrices/morton.h"
+#include "../Multiplicacion_de_Matrices/fuera_de_memoria.h"
+#include "../Multiplicacion_de_Matrices/paralela.h"
+
+/**
+ * @brief Registra los algoritmos de ordenamiento de Ordenamiento/ y std::sort.
+ */
+inline void registrarAlgoritmosOrdenamiento(RegistroBenchmark& registro) {
+    registro.registrarOrdenamiento("Selection Sort", [](std::vector<int>& datos) {
+        seleccion(datos.begin(), datos.end());
+    });
+    registro.registrarOrdenamiento("Selection Sort (argmin vectorizado)", [](std::vector<int>& datos) {
+        seleccionVectorizada(datos.data(), datos.data() + datos.size());
+    });
+    registro.registrarOrdenamiento("Selection Sort por torneo", [](std::vector<int>& datos) {
+        seleccionPorTorneo(datos.begin(), datos.end());
+    });
+    registro.registrarOrdenamiento("Merge Sort", [](std::vector<int>& datos) {
+        mergeSort(datos.begin(), datos.end());
+    });
+    registro.registrarOrdenamiento("Quick Sort", [](std::vector<int>& datos) {
+        quickSort(datos.begin(), datos.end());
+    });
+    registro.registrarOrdenamiento("Biblioteca estándar (std::sort)", [](std::vector<int>& datos) {
+        std::sort(datos.begin(), datos.end());
+    });
+}
+
+/**
+ * @brief Número de elementos del top-k usado en las pruebas: 1% de n, al menos 1.
+ */
+inline size_t tamanoTopK(size_t n) {
+    return std::max<size_t>(n / 100, 1);
+}
+
+/**
+ * @brief Registra la selección de la mediana y el top-k junto a sus equivalentes estándar.
+ */
+inline void registrarAlgoritmosSeleccion(RegistroBenchmark& registro) {
+    auto verificarMediana = [](const ChecksumMulticonjunto& original, const std::vector<int>& d) {
+        return verificarSeleccion(original, d, d.size() / 2);
+    };
+    auto verificarPrefijo = [](const ChecksumMulticonjunto& original, const std::vector<int>& d) {
+        return verificarTopK(original, d, tamanoTopK(d.size()));
+    };
+
+    registro.registrarOperacion("std::nth_element (mediana)", [](std::vector<int>& d) {
+        std::nth_element(d.begin(), d.begin() + d.size() / 2, d.end());
+    }, verificarMediana);
+    registro.registrarOperacion("Floyd-Rivest (mediana)", [](std::vector<int>& d) {
+        floydRivest(d.begin(), d.begin() + d.size() / 2, d.end());
+    }, verificarMediana);
+    registro.registrarOperacion("Introselect (mediana)", [](std::vector<int>& d) {
+        introselect(d.begin(), d.begin() + d.size() / 2, d.end());
+    }, verificarMediana);
+    registro.registrarOperacion("std::partial_sort (top-k)", [](std::vector<int>& d) {
+        std::partial_sort(d.begin(), d.begin() + tamanoTopK(d.size()), d.end());
+    }, verificarPrefijo);
+    registro.registrarOperacion("Quick Sort parcial (top-k)", [](std::vector<int>& d) {
+        ordenamientoParcial(d.begin(), d.begin() + tamanoTopK(d.size()), d.end());
+    }, verificarPrefijo);
+    registro.registrarOperacion("Top-k con montículo", [](std::vector<int>& d) {
+        TopK<int> topK(tamanoTopK(d.size()));
+        for (int valor : d) {
+            topK.agregar(valor);
+        }
+
+        // Dejar los k menores al principio, como std::partial_sort: primero los menores que el
+        // umbral, luego los iguales, y encima la lista ordenada (que es el mismo multiconjunto)
+        std::vector<int> menores = topK.resultado();
+        int umbral = menores.back();
+        auto iguales = std::partition(d.begin(), d.end(), [umbral](int valor) { return valor < umbral; });
+        std::partition(iguales, d.end(), [umbral](int valor) { return valor == umbral; });
+        std::copy(menores.begin(), menores.end(), d.begin());
+    }, verificarPrefijo);
+}
+
+/**
+ * @brief Agrega el top-k en flujo, que lee cada archivo sin cargarlo entero en memoria.
+ *
+ * La medición incluye la lectura del archivo; se verifica contra std::partial_sort.
+ */
+inline void agregarTopKEnFlujo(RegistroBenchmark& registro, const std::vector<std::string>& archivos) {
+    for (const std::string& archivo : archivos) {
+        std::string descripcion = obtenerDescripcionDataset(archivo);
+        registro.agregarGrupo({descripcion, [archivo, descripcion]() {
+            std::vector<Prueba> pruebas;
+            std::shared_ptr<const std::vector<int>> datos = cacheDatasets().dataset(archivo);
+            if (datos->empty()) {
+                return pruebas;
+            }
+
+            size_t k = tamanoTopK(datos->size());
+            auto esperado = std::make_shared<std::vector<int>>(*datos);
+            std::partial_sort(esperado->begin(), esperado->begin() + k, esperado->end());
+            esperado->resize(k);
+            auto resultado = std::make_shared<std::vector<int>>();
+
+            Prueba prueba;
+            prueba.algoritmo = "Top-k en flujo desde archivo";
+            prueba.dataset = descripcion;
+            prueba.trabajo = static_cast<double>(datos->size());
+            prueba.unidad = "elem/s";
+            prueba.ejecutar = [archivo, k, resultado]() { *resultado = topKDesdeArchivo(archivo, k); };
+            prueba.verificar = [esperado, resultado]() { return *esperado == *resultado; };
+            pruebas.push_back(std::move(prueba));
+            return pruebas;
+        }});
+    }
+}
+
+/**
+ * @brief Registra los multiplicadores de Multiplicacion_de_Matrices/.
+ */
+inline void registrarAlgoritmosMatrices(RegistroBenchmark& registro) {
+    registro.registrarMultiplicacion("Multiplicación Tradicional", [](const std::vector<std::vector<int>>& A, const std::vector<std::vector<int>>& B) {
+        return multiplicarMatrices(A, B, A.size(), B.size(), B[0].size());
+    });
+    registro.registrarMultiplicacion("Multiplicación Optimizada", [](const std::vector<std::vector<int>>& A, const std::vector<std::vector<int>>& B) {
+        return multiplicarMatricesOptimizado(A, B, A.size(), B.size(), B[0].size());
+    });
+    registro.registrarMultiplicacion("Multiplicación por Bloques", [](const std::vector<std::vector<int>>& A, const std::vector<std::vector<int>>& B) {
+        return multiplicarMatricesBloques(A, B);
+    });
+    registro.registrarMultiplicacion("Strassen", [](const std::vector<std::vector<int>>& A, const std::vector<std::vector<int>>& B) {
+        return strassenMultiplicacion(A, B);
+    });
+    registro.registrarMultiplicacion("Multiplicación Morton", [](const std::vector<std::vector<int>>& A, const std::vector<std::vector<int>>& B) {
+        return multiplicarMatricesMorton(A, B);
+    });
+    registro.registrarMultiplicacion("Strassen sobre Morton", [](const std::vector<std::vector<int>>& A, const std::vector<std::vector<int>>& B) {
+        return strassenMultiplicacionMorton(A, B);
+    });
+    registro.registrarMultiplicacion("Multiplicación Entera Estrecha", [](const std::vector<std::vector<int>>& A, const std::vector<std::vector<int>>& B) {
+        return multiplicarMatricesEstrecho(A, B);
+    });
+}
+
+/**
+ * @brief Agrega los productos dispersos (SpMM y SpGEMM) sobre los casos indicados.
+ *
+ * Las conversiones a CSR se hacen al cargar el caso, fuera de la medición. El
+ * rendimiento se expresa en GFLOP/s equivalentes al producto denso (2·m·k·n), de modo
+ * que se compara directamente con los multiplicadores densos sobre los mismos archivos.
+ */
+inline void agregarMultiplicacionDispersa(RegistroBenchmark& registro, const std::vector<CasoMatrices>& casos) {
+    for (const CasoMatrices& caso : casos) {
+        std::string descripcion = RegistroBenchmark::descripcionCaso(caso);
+        registro.agregarGrupo({descripcion, [caso, descripcion]() {
+            std::vector<Prueba> pruebas;
+            using Densa = std::vector<std::vector<int>>;
+            auto A = cacheDatasets().matriz(caso.archivoA, caso.filasA, caso.columnasA);
+            auto B = cacheDatasets().matriz(caso.archivoB, caso.columnasA, caso.columnasB);
+            auto dispersaA = std::make_shared<const MatrizCSR<int>>(csrDesdeDensa(*A));
+            auto dispersaB = std::make_shared<const MatrizCSR<int>>(csrDesdeDensa(*B));
+            double trabajo = 2.0 * caso.filasA * caso.columnasA * caso.columnasB / 1e9;
+
+            auto agregar = [&](const std::string& nombre, std::function<Densa()> producto) {
+                auto C = std::make_shared<Densa>();
+                Prueba prueba;
+                prueba.algoritmo = nombre;
+                prueba.dataset = descripcion;
+                prueba.trabajo = trabajo;
+                prueba.unidad = "GFLOP/s";
+                prueba.preparar = [C]() { C->clear(); };
+                prueba.ejecutar = [C, producto]() { *C = producto(); };
+                prueba.verificar = [A, B, C]() { return freivalds(*A, *B, *C); };
+                pruebas.push_back(std::move(prueba));
+            };
+
+            // Los productos dispersa x dispersa se expanden a densa sólo para verificarlos
+            auto agregarSpgemm = [&](const std::string& nombre, std::function<MatrizCSR<int>()> producto) {
+                auto C = std::make_shared<MatrizCSR<int>>();
+                Prueba prueba;
+                prueba.algoritmo = nombre;
+                prueba.dataset = descripcion;
+                prueba.trabajo = trabajo;
+                prueba.unidad = "GFLOP/s";
+                prueba.preparar = [C]() { *C = MatrizCSR<int>(); };
+                prueba.ejecutar = [C, producto]() { *C = producto(); };
+                prueba.verificar = [A, B, C]() { return freivalds(*A, *B, densaDesdeCsr(*C)); };
+                pruebas.push_back(std::move(prueba));
+            };
+
+            agregar("SpMM (CSR x densa)", [dispersaA, B]() { return multiplicarDispersaDensa(*dispersaA, *B); });
+            agregarSpgemm("SpGEMM Gustavson (acumulador denso)", [dispersaA, dispersaB]() { return spgemmDenso(*dispersaA, *dispersaB); });
+            agregarSpgemm("SpGEMM Gustavson (acumulador hash)", [dispersaA, dispersaB]() { return spgemmHash(*dispersaA, *dispersaB); });
+            agregarSpgemm("SpGEMM Gustavson paralelo", [dispersaA, dispersaB]() { return spgemmParalelo(*dispersaA, *dispersaB); });
+            return pruebas;
+        }});
+    }
+}
+
+/**
+ * @brief Tamaños de las matrices de los lotes generados.
+ */
+inline std::vector<int> tamanosLote() {
+    return {4, 8, 16, 32};
+}
+
+/**
+ * @brief Agrega la multiplicación por lotes sobre lotes generados de matrices n x n.
+ *
+ * Cada lote ocupa unos 16 MB por operando (al menos 1024 matrices). Se compara la
+ * disposición intercalada, la contigua y la llamada a multiplicarMatrices por cada
+ * matriz; el rendimiento se expresa en matrices por segundo.
+ */
+inline void agregarMultiplicacionPorLotes(RegistroBenchmark& registro) {
+    for (int n : tamanosLote()) {
+        int cantidad = std::max(1024, (1 << 22) / (n * n));
+        std::string descripcion = "lote de " + std::to_string(cantidad) + " matrices " + std::to_string(n) + "x" + std::to_string(n);
+        registro.agregarGrupo({descripcion, [n, cantidad, descripcion]() {
+            std::vector<Prueba> pruebas;
+            auto A = std::make_shared<const LoteMatrices<int>>(generarLoteAleatorio(cantidad, n, n, LOTE_CONTIGUO));
+            auto B = std::make_shared<const LoteMatrices<int>>(generarLoteAleatorio(cantidad, n, n, LOTE_CONTIGUO));
+
+            // Resultado de referencia, calculado matriz a matriz fuera de la medición
+            auto esperado = std::make_shared<LoteMatrices<int>>(cantidad, n, n, LOTE_CONTIGUO);
+            for (int b = 0; b < cantidad; b++) {
+                for (int i = 0; i < n; i++) {
+                    for (int j = 0; j < n; j++) {
+                        int suma = 0;
+                        for (int k = 0; k < n; k++) {
+                            suma += A->vista().elemento(b, i, k) * B->vista().elemento(b, k, j);
+                        }
+                        esperado->vista().elemento(b, i, j) = suma;
+                    }
+                }
+            }
+            auto coincide = [esperado](const LoteMatrices<int>& resultado) {
+                VistaLote<const int> C = resultado.vista();
+                for (int b = 0; b < esperado->cantidad; b++) {
+                    for (int i = 0; i < esperado->filas; i++) {
+                        for (int j = 0; j < esperado->columnas; j++) {
+                            if (C.elemento(b, i, j) != esperado->vista().elemento(b, i, j)) {
+                                return false;
+                            }
+                        }
+                    }
+                }
+                return true;
+            };
+
+            auto nuevaPrueba = [&](const std::string& nombre) {
+                Prueba prueba;
+                prueba.algoritmo = nombre;
+                prueba.dataset = descripcion;
+                prueba.trabajo = cantidad;
+                prueba.unidad = "mat/s";
+                return prueba;
+            };
+
+            // Las dos disposiciones del API por lotes
+            for (DisposicionLote disposicion : {LOTE_INTERCALADO, LOTE_CONTIGUO}) {
+                auto copiaA = std::make_shared<LoteMatrices<int>>(cantidad, n, n, disposicion);
+                auto copiaB = std::make_shared<LoteMatrices<int>>(cantidad, n, n, disposicion);
+                for (int b = 0; b < cantidad; b++) {
+                    for (int i = 0; i < n; i++) {
+                        for (int j = 0; j < n; j++) {
+                            copiaA->vista().elemento(b, i, j) = A->vista().elemento(b, i, j);
+                            copiaB->vista().elemento(b, i, j) = B->vista().elemento(b, i, j);
+                        }
+                    }
+                }
+                std::shared_ptr<const LoteMatrices<int>> entradaA = copiaA, entradaB = copiaB;
+                auto C = std::make_shared<LoteMatrices<int>>(cantidad, n, n, disposicion);
+
+                Prueba prueba = nuevaPrueba(disposicion == LOTE_INTERCALADO ? "Lote intercalado" : "Lote contiguo");
+                prueba.ejecutar = [entradaA, entradaB, C]() { multiplicarLote(entradaA->vista(), entradaB->vista(), C->vista()); };
+                prueba.verificar = [C, coincide]() { return coincide(*C); };
+                pruebas.push_back(std::move(prueba));
+            }
+
+            // Referencia: una llamada a multiplicarMatrices por matriz
+            using Densa = std::vector<std::vector<int>>;
+            auto matricesA = std::make_shared<std::vector<Densa>>(cantidad, Densa(n, std::vector<int>(n)));
+            auto matricesB = std::make_shared<std::vector<Densa>>(cantidad, Densa(n, std::vector<int>(n)));
+            for (int b = 0; b < cantidad; b++) {
+                for (int i = 0; i < n; i++) {
+                    for (int j = 0; j < n; j++) {
+                        (*matricesA)[b][i][j] = A->vista().elemento(b, i, j);
+                        (*matricesB)[b][i][j] = B->vista().elemento(b, i, j);
+                    }
+                }
+            }
+            auto matricesC = std::make_shared<std::vector<Densa>>();
+
+            Prueba prueba = nuevaPrueba("multiplicarMatrices por matriz");
+            prueba.preparar = [matricesC]() { matricesC->clear(); };
+            prueba.ejecutar = [matricesA, matricesB, matricesC, n]() {
+                matricesC->reserve(matricesA->size());
+                for (size_t b = 0; b < matricesA->size(); b++) {
+                    matricesC->push_back(multiplicarMatrices((*matricesA)[b], (*matricesB)[b], n, n, n));
+                }
+            };
+            prueba.verificar = [matricesC, esperado]() {
+                if (static_cast<int>(matricesC->size()) != esperado->cantidad) {
+                    return false;
+                }
+                for (int b = 0; b < esperado->cantidad; b++) {
+                    for (int i = 0; i < esperado->filas; i++) {
+                        for (int j = 0; j < esperado->columnas; j++) {
+                            if ((*matricesC)[b][i][j] != esperado->vista().elemento(b, i, j)) {
+                                return false;
+                            }
+                        }
+                    }
+                }
+                return true;
+            };
+            pruebas.push_back(std::move(prueba));
+
+            // Núcleo de tamaño fijo elegido por el lado, también una llamada por matriz
+            auto fijasC = std::make_shared<std::vector<Densa>>();
+            Prueba fija = nuevaPrueba("Tamaño fijo por matriz");
+            fija.preparar = [fijasC, cantidad]() { fijasC->assign(cantidad, Densa()); };
+            fija.ejecutar = [matricesA, matricesB, fijasC]() {
+                for (size_t b = 0; b < matricesA->size(); b++) {
+                    multiplicarCuadradaFija((*matricesA)[b], (*matricesB)[b], (*fijasC)[b]);
+                }
+            };
+            fija.verificar = [fijasC, esperado]() {
+                for (int b = 0; b < esperado->cantidad; b++) {
+                    for (int i = 0; i < esperado->filas; i++) {
+                        for (int j = 0; j < esperado->columnas; j++) {
+                            if ((*fijasC)[b][i][j] != esperado->vista().elemento(b, i, j)) {
+                                return false;
+                            }
+                        }
+                    }
+                }
+                return true;
+            };
+            pruebas.push_back(std::move(fija));
+            return pruebas;
+        }});
+    }
+}
+
+/**
+ * @brief Dimensiones de las cadenas de matrices medidas: la de los casos rectangulares extendida y dos de 12 y 20 factores.
+ */
+inline std::vector<std::vector<int>> cadenasMatrices() {
+    return {
+        {100, 500, 1000, 20, 800, 50, 600},
+        {495, 285, 551, 368, 156, 400, 21, 393, 504, 290, 481, 243, 581},
+        {82, 138, 56, 172, 298, 91, 18, 215, 213, 43, 57, 69, 168, 247, 235, 215, 111, 107, 167, 176, 173}
+    };
+}
+
+/**
+ * @brief Genera los factores de una cadena con valores de punto flotante entre 0 y 1.
+ *
+ * Se usa double porque con enteros el producto de una cadena larga desborda.
+ */
+inline std::vector<std::vector<std::vector<double>>> generarCadena(const std::vector<int>& dimensiones) {
+    std::mt19937 generador(std::random_device{}());
+    std::uniform_real_distribution<double> distribucion(0.0, 1.0);
+    std::vector<std::vector<std::vector<double>>> matrices;
+    for (size_t i = 0; i + 1 < dimensiones.size(); i++) {
+        std::vector<std::vector<double>> M(dimensiones[i], std::vector<double>(dimensiones[i + 1]));
+        for (auto& fila : M) {
+            for (double& valor : fila) {
+                valor = distribucion(generador);
+            }
+        }
+        matrices.push_back(std::move(M));
+    }
+    return matrices;
+}
+
+/**
+ * @brief Agrega la multiplicación de cadenas: plan óptimo frente a izquierda a derecha y multiplicador fijo.
+ *
+ * El trabajo de cada prueba son los flops previstos por su propio plan, así que el tiempo
+ * compara los planes y los GFLOP/s comparan los multiplicadores.
+ */
+inline void agregarCadenasMatrices(RegistroBenchmark& registro) {
+    for (const std::vector<int>& dimensiones : cadenasMatrices()) {
+        std::string descripcion = "cadena de " + std::to_string(dimensiones.size() - 1) + " matrices";
+        registro.agregarGrupo({descripcion, [dimensiones, descripcion]() {
+            std::vector<Prueba> pruebas;
+            auto matrices = std::make_shared<const std::vector<std::vector<std::vector<double>>>>(generarCadena(dimensiones));
+
+            auto agregar = [&](const std::string& nombre, const PlanCadena& plan, NucleoProducto nucleo) {
+                auto C = std::make_shared<std::vector<std::vector<double>>>();
+                Prueba prueba;
+                prueba.algoritmo = nombre;
+                prueba.dataset = descripcion;
+                prueba.trabajo = plan.flops / 1e9;
+                prueba.unidad = "GFLOP/s";
+                prueba.preparar = [C]() { C->clear(); };
+                prueba.ejecutar = [matrices, plan, nucleo, C]() { *C = ejecutarCadena(*matrices, plan, nucleo); };
+                prueba.verificar = [matrices, C]() { return verificarCadena(*matrices, *C); };
+                pruebas.push_back(std::move(prueba));
+            };
+
+            PlanCadena optimo = planificarCadena(dimensiones);
+            agregar("Cadena con plan óptimo", optimo, NUCLEO_AUTOMATICO);
+            agregar("Cadena de izquierda a derecha", planIzquierdaADerecha(dimensiones), NUCLEO_AUTOMATICO);
+            agregar("Cadena con plan óptimo y Multiplicación Optimizada", optimo, NUCLEO_OPTIMIZADO);
+            return pruebas;
+        }});
+    }
+}
+
+/**
+ * @brief Agrega las transpuestas de la primera matriz de cada caso: ingenua, recursiva por teselas y en sitio.
+ *
+ * Las matrices cuadradas se transponen en sitio sobre vector<vector<T>>; las rectangulares,
+ * sobre una copia por filas en un único vector, siguiendo los ciclos de la permutación.
+ * El rendimiento se expresa en elementos transpuestos por segundo.
+ */
+inline void agregarTranspuestas(RegistroBenchmark& registro, const std::vector<CasoMatrices>& casos) {
+    for (const CasoMatrices& caso : casos) {
+        std::string descripcion = "transpuesta de " + caso.archivoA + " (" + std::to_string(caso.filasA) + "x" + std::to_string(caso.columnasA) + ")";
+        registro.agregarGrupo({descripcion, [caso, descripcion]() {
+            std::vector<Prueba> pruebas;
+            using Densa = std::vector<std::vector<int>>;
+            auto A = cacheDatasets().matriz(caso.archivoA, caso.filasA, caso.columnasA);
+            int filas = caso.filasA;
+            int columnas = caso.columnasA;
+
+            auto esTranspuesta = [A, filas, columnas](const Densa& transpuesta) {
+                if (static_cast<int>(transpuesta.size()) != columnas) {
+                    return false;
+                }
+                for (int j = 0; j < columnas; j++) {
+                    if (static_cast<int>(transpuesta[j].size()) != filas) {
+                        return false;
+                    }
+                    for (int i = 0; i < filas; i++) {
+                        if (transpuesta[j][i] != (*A)[i][j]) {
+                            return false;
+                        }
+                    }
+                }
+                return true;
+            };
+
+            auto nuevaPrueba = [&](const std::string& nombre) {
+                Prueba prueba;
+                prueba.algoritmo = nombre;
+                prueba.dataset = descripcion;
+                prueba.trabajo = static_cast<double>(filas) * columnas;
+                prueba.unidad = "elem/s";
+                return prueba;
+            };
+
+            // El destino se reserva una vez y se pone a cero antes de cada repetición
+            auto limpiar = [](Densa& destino) {
+                for (auto& fila : destino) {
+                    std::fill(fila.begin(), fila.end(), 0);
+                }
+            };
+
+            auto destinoIngenua = std::make_shared<Densa>();
+            Prueba ingenua = nuevaPrueba("Transpuesta ingenua");
+            ingenua.preparar = [destinoIngenua, limpiar]() { limpiar(*destinoIngenua); };
+            ingenua.ejecutar = [A, destinoIngenua]() { transponerIngenua(*A, *destinoIngenua); };
+            ingenua.verificar = [destinoIngenua, esTranspuesta]() { return esTranspuesta(*destinoIngenua); };
+            pruebas.push_back(std::move(ingenua));
+
+            auto destinoRecursiva = std::make_shared<Densa>();
+            Prueba recursiva = nuevaPrueba("Transpuesta recursiva por teselas");
+            recursiva.preparar = [destinoRecursiva, limpiar]() { limpiar(*destinoRecursiva); };
+            recursiva.ejecutar = [A, destinoRecursiva]() { transponerEn(*A, *destinoRecursiva); };
+            recursiva.verificar = [destinoRecursiva, esTranspuesta]() { return esTranspuesta(*destinoRecursiva); };
+            pruebas.push_back(std::move(recursiva));
+
+            if (filas == columnas) {
+                auto matriz = std::make_shared<Densa>();
+                Prueba enSitio = nuevaPrueba("Transpuesta en sitio (cuadrada)");
+                enSitio.preparar = [A, matriz]() { *matriz = *A; };
+                enSitio.ejecutar = [matriz]() { transponerCuadradaEnSitio(*matriz); };
+                enSitio.verificar = [matriz, esTranspuesta]() { return esTranspuesta(*matriz); };
+                pruebas.push_back(std::move(enSitio));
+            } else {
+                auto datos = std::make_shared<std::vector<int>>();
+                Prueba ciclos = nuevaPrueba("Transpuesta en sitio (ciclos)");
+                ciclos.preparar = [A, datos]() {
+                    datos->clear();
+                    for (const auto& fila : *A) {
+                        datos->insert(datos->end(), fila.begin(), fila.end());
+                    }
+                };
+                ciclos.ejecutar = [datos, filas, columnas]() { transponerEnSitio(*datos, filas, columnas); };
+                ciclos.verificar = [datos, esTranspuesta, filas, columnas]() {
+                    Densa transpuesta(columnas);
+                    for (int j = 0; j < columnas; j++) {
+                        transpuesta[j].assign(datos->begin() + static_cast<size_t>(j) * filas, datos->begin() + static_cast<size_t>(j + 1) * filas);
+                    }
+                    return esTranspuesta(transpuesta);
+                };
+                pruebas.push_back(std::move(ciclos));
+            }
+            return pruebas;
+        }});
+    }
+}
+
+/**
+ * @brief Presupuestos de memoria (en bytes) con los que se mide la multiplicación fuera de memoria.
+ */
+inline std::vector<size_t> presupuestosFueraDeMemoria() {
+    return {256 << 10, 1 << 20, 4 << 20};
+}
+
+/**
+ * @brief Ruta única en el directorio temporal que se borra al liberar el último shared_ptr.
+ *
+ * Los grupos que escriben archivos para medir su lectura los dejan aquí y no junto a los
+ * datasets; el número de orden evita que dos grupos cargados a la vez (con la precarga)
+ * compartan un archivo que el primero en terminar borraría.
+ */
+inline std::shared_ptr<const std::string> archivoTemporalBenchmark(const std::string& nombre) {
+    static std::atomic<int> siguiente(0);
+    std::error_code error;
+    std::filesystem::path directorio = std::filesystem::temp_directory_path(error);
+    if (error) {
+        directorio = ".";
+    }
+    std::string ruta = (directorio / ("benchmark_" + std::to_string(siguiente++) + "_" + nombre)).string();
+    return std::shared_ptr<const std::string>(new std::string(ruta), [](const std::string* archivo) {
+        std::remove(archivo->c_str());
+        delete archivo;
+    });
+}
+
+/**
+ * @brief Agrega la multiplicación fuera de memoria sobre las versiones binarias de los casos.
+ *
+ * Los archivos de texto se convierten a binario al cargar el caso (una sola vez si A y B
+ * son el mismo archivo), en archivos temporales que se borran junto con el producto al
+ * liberar el grupo. Las matrices se leen además enteras, sólo para verificar el producto
+ * escrito en disco con Freivalds.
+ */
+inline void agregarMultiplicacionFueraDeMemoria(RegistroBenchmark& registro, const std::vector<CasoMatrices>& casos) {
+    for (const CasoMatrices& caso : casos) {
+        std::string descripcion = RegistroBenchmark::descripcionCaso(caso) + " desde disco";
+        registro.agregarGrupo({descripcion, [caso, descripcion]() {
+            std::vector<Prueba> pruebas;
+            auto nombreBinario = [](const std::string& archivo) {
+                return std::filesystem::path(archivoMatrizBinaria(archivo)).filename().string();
+            };
+            auto binarioA = archivoTemporalBenchmark(nombreBinario(caso.archivoA));
+            if (!convertirTextoABinario<int>(caso.archivoA, *binarioA, caso.filasA, caso.columnasA)) {
+                return pruebas;
+            }
+            auto binarioB = binarioA;
+            if (caso.archivoB != caso.archivoA || caso.columnasA != caso.filasA || caso.columnasB != caso.columnasA) {
+                binarioB = archivoTemporalBenchmark(nombreBinario(caso.archivoB));
+                if (!convertirTextoABinario<int>(caso.archivoB, *binarioB, caso.columnasA, caso.columnasB)) {
+                    return pruebas;
+                }
+            }
+            auto binarioC = archivoTemporalBenchmark("producto_" + std::to_string(caso.filasA) + "x" + std::to_string(caso.columnasB) + ".bin");
+            auto A = cacheDatasets().matriz(caso.archivoA, caso.filasA, caso.columnasA);
+            auto B = cacheDatasets().matriz(caso.archivoB, caso.columnasA, caso.columnasB);
+
+            for (size_t presupuesto : presupuestosFueraDeMemoria()) {
+                auto correcto = std::make_shared<bool>(false);
+                Prueba prueba;
+                prueba.algoritmo = "Fuera de memoria (" + std::to_string(presupuesto >> 10) + " KiB)";
+                prueba.dataset = descripcion;
+                prueba.trabajo = 2.0 * caso.filasA * caso.columnasA * caso.columnasB / 1e9;
+                prueba.unidad = "GFLOP/s";
+                prueba.ejecutar = [binarioA, binarioB, binarioC, presupuesto, correcto]() {
+                    *correcto = multiplicarFueraDeMemoria<int>(*binarioA, *binarioB, *binarioC, presupuesto);
+                };
+                prueba.verificar = [A, B, binarioC, correcto]() {
+                    return *correcto && freivalds(*A, *B, leerMatrizBinaria<int>(*binarioC));
+                };
+                pruebas.push_back(std::move(prueba));
+            }
+            return pruebas;
+        }});
+    }
+}
+
+/**
+ * @brief Configuraciones de memoria comparadas, con el nombre que aparece en los resultados.
+ *
+ * La primera reproduce lo que ocurre con los vectores de siempre: páginas de 4 KiB que
+ * inicializa el hilo principal y trabajadores sin fijar. Si no hay páginas reservadas en
+ * hugetlbfs, el nombre de la última indica que se usó THP en su lugar.
+ */
+inline std::vector<std::pair<std::string, ConfiguracionNuma>> configuracionesNuma() {
+    std::vector<std::pair<std::string, ConfiguracionNuma>> configuraciones = {
+        {"páginas de 4 KiB, sin primer toque ni afinidad", {PAGINAS_NORMALES, false, false}},
+        {"páginas de 4 KiB, primer toque y afinidad", {PAGINAS_NORMALES, true, true}},
+        {"THP de 2 MiB, primer toque y afinidad", {PAGINAS_THP, true, true}},
+        {"hugetlbfs de 2 MiB, primer toque y afinidad", {PAGINAS_HUGETLB, true, true}}
+    };
+    if (BufferGrande<int>(1, PAGINAS_HUGETLB).paginas() != PAGINAS_HUGETLB) {
+        configuraciones.back().first = "hugetlbfs no disponible (THP), primer toque y afinidad";
+    }
+    return configuraciones;
+}
+
+/**
+ * @brief Agrega Merge Sort y la multiplicación por bloques paralelos con cada configuración de memoria.
+ *
+ * Los operandos se copian a los buffers de cada configuración al cargar el grupo (las
+ * matrices) o antes de cada repetición (los datasets), fuera de la medición; los
+ * resultados y auxiliares se reservan e inicializan dentro, como parte del núcleo. La
+ * diferencia de tiempo entre configuraciones muestra el efecto de las páginas grandes y,
+ * en máquinas con varios nodos, del primer toque y la afinidad. Los contadores de
+ * hardware no sirven aquí: sólo cuentan el hilo que mide, que espera a los trabajadores.
+ */
+inline void agregarMemoriaParalela(RegistroBenchmark& registro, const std::vector<std::string>& archivos, const std::vector<CasoMatrices>& casos) {
+    for (const std::string& archivo : archivos) {
+        std::string descripcion = obtenerDescripcionDataset(archivo) + " (memoria paralela)";
+        registro.agregarGrupo({descripcion, [archivo, descripcion]() {
+            std::vector<Prueba> pruebas;
+            std::shared_ptr<const std::vector<int>> original = cacheDatasets().dataset(archivo);
+            if (original->empty()) {
+                return pruebas;
+            }
+            ChecksumMulticonjunto checksum = checksumMulticonjunto(*original);
+
+            for (const auto& configuracion : configuracionesNuma()) {
+                ConfiguracionNuma numa = configuracion.second;
+                auto grupo = std::make_shared<GrupoHilos>(numa.hilos, numa.fijarHilos);
+                auto datos = std::make_shared<BufferGrande<int>>();
+
+                Prueba prueba;
+                prueba.algoritmo = "Merge Sort paralelo (" + configuracion.first + ")";
+                prueba.dataset = descripcion;
+                prueba.trabajo = static_cast<double>(original->size());
+                prueba.unidad = "elem/s";
+                prueba.preparar = [original, datos, grupo, numa]() {
+                    *datos = copiarABufferGrande(original->data(), original->size(), *grupo, numa);
+                };
+                prueba.ejecutar = [datos, grupo, numa]() { ordenarParalelo(*datos, *grupo, numa); };
+                prueba.verificar = [datos, checksum]() {
+                    return verificarOrdenamiento(checksum, std::vector<int>(datos->begin(), datos->end()));
+                };
+                pruebas.push_back(std::move(prueba));
+            }
+            return pruebas;
+        }});
+    }
+
+    for (const CasoMatrices& caso : casos) {
+        std::string descripcion = RegistroBenchmark::descripcionCaso(caso) + " (memoria paralela)";
+        registro.agregarGrupo({descripcion, [caso, descripcion]() {
+            std::vector<Prueba> pruebas;
+            auto A = cacheDatasets().matriz(caso.archivoA, caso.filasA, caso.columnasA);
+            auto B = cacheDatasets().matriz(caso.archivoB, caso.columnasA, caso.columnasB);
+
+            for (const auto& configuracion : configuracionesNuma()) {
+                ConfiguracionNuma numa = configuracion.second;
+                auto grupo = std::make_shared<GrupoHilos>(numa.hilos, numa.fijarHilos);
+                auto planaA = std::make_shared<const MatrizPlana<int>>(copiarMatrizPlana(*A, *grupo, numa));
+                auto planaB = std::make_shared<const MatrizPlana<int>>(copiarMatrizPlana(*B, *grupo, numa));
+                auto C = std::make_shared<MatrizPlana<int>>();
+
+                Prueba prueba;
+                prueba.algoritmo = "Multiplicación por Bloques paralela (" + configuracion.first + ")";
+                prueba.dataset = descripcion;
+                prueba.trabajo = 2.0 * caso.filasA * caso.columnasA * caso.columnasB / 1e9;
+                prueba.unidad = "GFLOP/s";
+                prueba.preparar = [C]() { *C = MatrizPlana<int>(); };
+                prueba.ejecutar = [planaA, planaB, C, grupo, numa]() { *C = multiplicarPlanaParalela(*planaA, *planaB, *grupo, numa); };
+                prueba.verificar = [A, B, C]() { return freivalds(*A, *B, aMatrizDensa(*C)); };
+                pruebas.push_back(std::move(prueba));
+            }
+            return pruebas;
+        }});
+    }
+}
+
+/**
+ * @brief Agrega la compresión y decodificación de cada dataset en el formato de comprimido.h.
+ *
+ * Se compara la lectura del archivo de texto con la del comprimido (lectura y
+ * decodificación) y se mide la decodificación sola, en memoria. La descripción indica los
+ * bits por entero que ocupa el dataset comprimido. El comprimido que se lee se escribe en
+ * un archivo temporal, que se borra al liberar el grupo: los .dcmp del generador no se tocan.
+ */
+inline void agregarDatasetsComprimidos(RegistroBenchmark& registro, const std::vector<std::string>& archivos) {
+    for (const std::string& archivo : archivos) {
+        registro.agregarGrupo({obtenerDescripcionDataset(archivo) + " comprimido", [archivo]() {
+            std::vector<Prueba> pruebas;
+            auto original = std::make_shared<const std::vector<int>>(leerDatasetDesdeArchivo(archivo));
+            if (original->empty()) {
+                return pruebas;
+            }
+            auto comprimido = std::make_shared<const DatasetComprimido>(*original);
+            auto archivoComprimido = archivoTemporalBenchmark(std::filesystem::path(archivoDatasetComprimido(archivo)).filename().string());
+            if (!comprimido->guardar(*archivoComprimido)) {
+                return pruebas;
+            }
+
+            char bits[32];
+            std::snprintf(bits, sizeof(bits), "%.2f", comprimido->bytes() * 8.0 / original->size());
+            std::string descripcion = obtenerDescripcionDataset(archivo) + " comprimido (" + bits + " bits por entero)";
+
+            auto resultado = std::make_shared<std::vector<int>>();
+            auto nuevaPrueba = [&](const std::string& nombre) {
+                Prueba prueba;
+                prueba.algoritmo = nombre;
+                prueba.dataset = descripcion;
+                prueba.trabajo = static_cast<double>(original->size());
+                prueba.unidad = "elem/s";
+                prueba.verificar = [original, resultado]() { return *original == *resultado; };
+                return prueba;
+            };
+
+            Prueba texto = nuevaPrueba("Lectura del archivo de texto");
+            texto.ejecutar = [archivo, resultado]() { *resultado = leerDatasetDesdeArchivo(archivo); };
+            pruebas.push_back(std::move(texto));
+
+            Prueba lectura = nuevaPrueba("Lectura del archivo comprimido");
+            lectura.ejecutar = [archivoComprimido, resultado]() {
+                DatasetComprimido leido;
+                *resultado = leido.leer(*archivoComprimido) ? leido.decodificar() : std::vector<int>();
+            };
+            pruebas.push_back(std::move(lectura));
+
+            Prueba decodificacion = nuevaPrueba("Decodificación en memoria");
+            decodificacion.preparar = [original, resultado]() { resultado->assign(original->size(), 0); };
+            decodificacion.ejecutar = [comprimido, resultado]() { comprimido->decodificar(resultado->data()); };
+            pruebas.push_back(std::move(decodificacion));
+
+            auto recomprimido = std::make_shared<DatasetComprimido>();
+            Prueba compresion = nuevaPrueba("Compresión (delta + empaquetado de bits)");
+            compresion.ejecutar = [original, recomprimido]() { *recomprimido = DatasetComprimido(*original); };
+            compresion.verificar = [original, recomprimido]() { return recomprimido->decodificar() == *original; };
+            pruebas.push_back(std::move(compresion));
+            return pruebas;
+        }});
+    }
+}
+
+/**
+ * @brief Agrega las entradas estándar: los nueve datasets de enteros y los casos de matrices densas y dispersas.
+ */
+inline void agregarEntradasEstandar(RegistroBenchmark& registro) {
+    for (const std::string& archivo : archivosOrdenamiento()) {
+        registro.agregarDatasetOrdenamiento(archivo);
+    }
+    for (const CasoMatrices& caso : casosMatrices()) {
+        registro.agregarCasoMatrices(caso);
+    }
+    for (const CasoMatrices& caso : casosMatricesDispersas()) {
+        registro.agregarCasoMatrices(caso);
+    }
+}
+
+#endif
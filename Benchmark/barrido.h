@@ -0,0 +1,309 @@
+#ifndef BARRIDO_H
+#define BARRIDO_H
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <random>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+// Barrido de tamaños: cada algoritmo registrado se mide sobre entradas generadas de
+// tamaños en progresión geométrica. Con las series se ajusta el exponente empírico
+// (t ~ c·n^b), se elige el modelo de complejidad que mejor las explica y se buscan las
+// rodillas en que el conjunto de trabajo deja de caber en cada nivel de caché.
+
+const double MINIMO_MS_AJUSTE = 0.02;  // Puntos más rápidos que esto son ruido del temporizador y no entran en los ajustes
+const double SALTO_RODILLA = 1.15;     // Aumento del costo normalizado a partir del cual se informa una rodilla
+
+/**
+ * @brief Parámetros del barrido, leídos desde la línea de comandos.
+ */
+struct OpcionesBarrido {
+    bool activo = false;
+    long long desde = 0;     // Tamaño inicial (0: el de cada tipo de algoritmo)
+    long long hasta = 0;     // Tamaño final (0: el de cada tipo de algoritmo)
+    double factor = 1.5;     // Razón entre tamaños consecutivos
+    double limiteMs = 1000;  // Un algoritmo deja de crecer cuando su mediana supera este tiempo
+};
+
+/**
+ * @brief Tipo de algoritmo barrido: determina la entrada, el conjunto de trabajo y los modelos candidatos.
+ */
+enum TipoBarrido {
+    BARRIDO_ORDENAMIENTO,  // n enteros
+    BARRIDO_MATRICES       // Dos matrices n x n
+};
+
+/**
+ * @brief Una medición del barrido.
+ */
+struct PuntoBarrido {
+    long long n = 0;
+    double bytes = 0;       // Conjunto de trabajo de la entrada y la salida
+    double mediana = 0;     // ms
+    double minimo = 0;      // ms
+    double p95 = 0;         // ms
+    double rendimiento = 0;
+    double costoNormalizado = 0;   // Mediana / modelo elegido, relativo al primer punto ajustado (0 si no entra en el ajuste)
+    double exponenteLocal = 0;     // Pendiente log-log respecto del punto anterior (0 en el primero)
+};
+
+/**
+ * @brief Serie de mediciones de un algoritmo y su ajuste.
+ */
+struct SerieBarrido {
+    std::string algoritmo;
+    TipoBarrido tipo = BARRIDO_ORDENAMIENTO;
+    std::string unidad;
+    std::vector<PuntoBarrido> puntos;
+    double exponente = 0;    // Pendiente de la recta de mínimos cuadrados en log-log
+    std::string modelo;      // Modelo candidato con menor error
+};
+
+/**
+ * @brief Nivel de caché de datos (o unificada) de la CPU 0.
+ */
+struct NivelCache {
+    int nivel = 0;
+    double bytes = 0;
+};
+
+/**
+ * @brief Tamaños n en progresión geométrica de razón factor entre desde y hasta, sin repetidos.
+ */
+inline std::vector<long long> tamanosGeometricos(long long desde, long long hasta, double factor) {
+    std::vector<long long> tamanos;
+    factor = std::max(factor, 1.01);
+    for (double valor = static_cast<double>(std::max(1LL, desde)); valor <= static_cast<double>(hasta) * (1 + 1e-9); valor *= factor) {
+        long long n = std::llround(valor);
+        if (tamanos.empty() || n != tamanos.back()) {
+            tamanos.push_back(n);
+        }
+    }
+    return tamanos;
+}
+
+/**
+ * @brief Rango de tamaños por defecto de cada tipo.
+ */
+inline void rangoBarrido(TipoBarrido tipo, long long& desde, long long& hasta) {
+    if (tipo == BARRIDO_ORDENAMIENTO) {
+        desde = 1000;
+        hasta = 4000000;
+    } else {
+        desde = 16;
+        hasta = 1024;
+    }
+}
+
+/**
+ * @brief Conjunto de trabajo de un punto en bytes: los datos ordenados, o A, B y C.
+ */
+inline double bytesTrabajo(TipoBarrido tipo, long long n) {
+    double valor = static_cast<double>(n);
+    return tipo == BARRIDO_ORDENAMIENTO ? valor * sizeof(int) : 3 * valor * valor * sizeof(int);
+}
+
+/**
+ * @brief n enteros entre 0 y n, como los datasets aleatorios; la semilla depende sólo de n.
+ */
+inline std::vector<int> generarDatosBarrido(long long n) {
+    std::mt19937 generador(static_cast<unsigned>(n));
+    std::uniform_int_distribution<> distribucion(0, static_cast<int>(std::min<long long>(n, 2147483647LL)));
+    std::vector<int> datos(static_cast<size_t>(n));
+    for (int& valor : datos) {
+        valor = distribucion(generador);
+    }
+    return datos;
+}
+
+/**
+ * @brief Matriz filas x columnas con valores entre 0 y 100, como los datasets de matrices.
+ */
+inline std::vector<std::vector<int>> generarMatrizBarrido(int filas, int columnas, unsigned semilla) {
+    std::mt19937 generador(semilla);
+    std::uniform_int_distribution<> distribucion(0, 100);
+    std::vector<std::vector<int>> matriz(filas, std::vector<int>(columnas));
+    for (auto& fila : matriz) {
+        for (int& valor : fila) {
+            valor = distribucion(generador);
+        }
+    }
+    return matriz;
+}
+
+/**
+ * @brief Niveles de caché de datos de la CPU 0 según /sys (vacío si no están disponibles).
+ */
+inline std::vector<NivelCache> nivelesCache() {
+    std::vector<NivelCache> niveles;
+    for (int indice = 0; indice < 8; indice++) {
+        std::string directorio = "/sys/devices/system/cpu/cpu0/cache/index" + std::to_string(indice) + "/";
+        std::ifstream archivoNivel(directorio + "level"), archivoTipo(directorio + "type"), archivoTamano(directorio + "size");
+        NivelCache nivel;
+        std::string tipo, tamano;
+        if (!(archivoNivel >> nivel.nivel) || !(archivoTipo >> tipo) || !(archivoTamano >> tamano) || tipo == "Instruction") {
+            continue;
+        }
+        // El tamaño viene como "48K", "2048K" o "32M"
+        nivel.bytes = std::atof(tamano.c_str());
+        char sufijo = tamano.empty() ? ' ' : tamano.back();
+        nivel.bytes *= sufijo == 'K' ? 1024.0 : sufijo == 'M' ? 1024.0 * 1024 : sufijo == 'G' ? 1024.0 * 1024 * 1024 : 1.0;
+        niveles.push_back(nivel);
+    }
+    std::sort(niveles.begin(), niveles.end(), [](const NivelCache& a, const NivelCache& b) { return a.nivel < b.nivel; });
+    return niveles;
+}
+
+/**
+ * @brief Modelo de complejidad candidato: nombre y f(n).
+ */
+struct ModeloComplejidad {
+    std::string nombre;
+    double (*f)(double);
+};
+
+/**
+ * @brief Modelos que se comparan para cada tipo; Strassen es n^log2(7).
+ */
+inline std::vector<ModeloComplejidad> modelosCandidatos(TipoBarrido tipo) {
+    if (tipo == BARRIDO_ORDENAMIENTO) {
+        return {
+            {"n", [](double n) { return n; }},
+            {"n log n", [](double n) { return n * std::log2(n); }},
+            {"n^2", [](double n) { return n * n; }},
+        };
+    }
+    return {
+        {"n^2", [](double n) { return n * n; }},
+        {"n^2.81", [](double n) { return std::pow(n, std::log2(7.0)); }},
+        {"n^3", [](double n) { return n * n * n; }},
+    };
+}
+
+/**
+ * @brief Ajusta la serie: exponente por mínimos cuadrados, mejor modelo, costo normalizado y exponentes locales.
+ *
+ * Cada modelo se ajusta como t = c·f(n) en escala logarítmica (c es la media de ln t − ln f);
+ * gana el de menor suma de residuos al cuadrado, así que se compara la forma de la curva
+ * y no la constante.
+ */
+inline void ajustarSerie(SerieBarrido& serie) {
+    // n = 1 tampoco entra: "n log n" vale 0 ahí y su logaritmo no existe
+    auto ajustable = [](const PuntoBarrido& p) { return p.mediana >= MINIMO_MS_AJUSTE && p.n > 1; };
+    std::vector<const PuntoBarrido*> validos;
+    for (const PuntoBarrido& p : serie.puntos) {
+        if (ajustable(p)) {
+            validos.push_back(&p);
+        }
+    }
+
+    for (size_t i = 1; i < serie.puntos.size(); i++) {
+        const PuntoBarrido& a = serie.puntos[i - 1];
+        PuntoBarrido& b = serie.puntos[i];
+        if (a.mediana > 0 && b.mediana > 0) {
+            b.exponenteLocal = std::log(b.mediana / a.mediana) / std::log(static_cast<double>(b.n) / a.n);
+        }
+    }
+
+    if (validos.size() < 2) {
+        serie.modelo = "insuficientes puntos";
+        return;
+    }
+
+    double mediaX = 0, mediaY = 0;
+    for (const PuntoBarrido* p : validos) {
+        mediaX += std::log(static_cast<double>(p->n));
+        mediaY += std::log(p->mediana);
+    }
+    mediaX /= validos.size();
+    mediaY /= validos.size();
+    double covarianza = 0, varianza = 0;
+    for (const PuntoBarrido* p : validos) {
+        double x = std::log(static_cast<double>(p->n)) - mediaX;
+        covarianza += x * (std::log(p->mediana) - mediaY);
+        varianza += x * x;
+    }
+    serie.exponente = varianza > 0 ? covarianza / varianza : 0;
+
+    double mejorError = -1;
+    const ModeloComplejidad* mejor = nullptr;
+    std::vector<ModeloComplejidad> modelos = modelosCandidatos(serie.tipo);
+    for (const ModeloComplejidad& modelo : modelos) {
+        double logC = 0;
+        for (const PuntoBarrido* p : validos) {
+            logC += std::log(p->mediana) - std::log(modelo.f(static_cast<double>(p->n)));
+        }
+        logC /= validos.size();
+        double error = 0;
+        for (const PuntoBarrido* p : validos) {
+            double residuo = std::log(p->mediana) - std::log(modelo.f(static_cast<double>(p->n))) - logC;
+            error += residuo * residuo;
+        }
+        if (mejor == nullptr || error < mejorError) {
+            mejorError = error;
+            mejor = &modelo;
+        }
+    }
+    serie.modelo = mejor->nombre;
+
+    // Costo por unidad del modelo, relativo al primer punto ajustado: 1 = misma eficiencia.
+    // Los puntos que no entran en el ajuste se quedan en 0, como exponenteLocal
+    double referencia = validos.front()->mediana / mejor->f(static_cast<double>(validos.front()->n));
+    for (PuntoBarrido& p : serie.puntos) {
+        double modelo = mejor->f(static_cast<double>(p.n));
+        p.costoNormalizado = ajustable(p) && modelo > 0 && referencia > 0 ? p.mediana / modelo / referencia : 0;
+    }
+}
+
+/**
+ * @brief Costo normalizado medio de los puntos ajustables cuyo conjunto de trabajo está en [minimo, maximo).
+ *
+ * @return double Media, o 0 si no hay puntos en el intervalo.
+ */
+inline double costoEnIntervalo(const SerieBarrido& serie, double minimo, double maximo) {
+    double suma = 0;
+    int cuenta = 0;
+    for (const PuntoBarrido& p : serie.puntos) {
+        if (p.costoNormalizado > 0 && p.bytes >= minimo && p.bytes < maximo) {
+            suma += p.costoNormalizado;
+            cuenta++;
+        }
+    }
+    return cuenta > 0 ? suma / cuenta : 0;
+}
+
+/**
+ * @brief Informa el ajuste de una serie y las rodillas de caché.
+ *
+ * Para cada nivel se compara el costo normalizado medio de los puntos cuyo conjunto de
+ * trabajo cabe en él (y no en el nivel anterior) con el de los que ya no caben (pero sí
+ * en el siguiente). Si aumenta en más de SALTO_RODILLA, se informa la rodilla y el primer
+ * tamaño que queda fuera.
+ */
+inline void imprimirAjuste(std::ostream& salida, const SerieBarrido& serie, const std::vector<NivelCache>& niveles) {
+    salida << serie.algoritmo << ": exponente " << std::fixed << std::setprecision(2) << serie.exponente
+           << ", mejor modelo " << serie.modelo << " (" << serie.puntos.size() << " puntos)" << std::defaultfloat << std::endl;
+
+    for (size_t i = 0; i < niveles.size(); i++) {
+        double anterior = i > 0 ? niveles[i - 1].bytes : 0;
+        double siguiente = i + 1 < niveles.size() ? niveles[i + 1].bytes : niveles[i].bytes * 64;
+        double dentro = costoEnIntervalo(serie, anterior, niveles[i].bytes);
+        double fuera = costoEnIntervalo(serie, niveles[i].bytes, siguiente);
+        if (dentro <= 0 || fuera <= 0 || fuera / dentro < SALTO_RODILLA) {
+            continue;
+        }
+        auto primero = std::find_if(serie.puntos.begin(), serie.puntos.end(), [&](const PuntoBarrido& p) {
+            return p.bytes >= niveles[i].bytes;
+        });
+        salida << "    rodilla al salir de L" << niveles[i].nivel << " (" << static_cast<long long>(niveles[i].bytes / 1024) << " KiB): costo x"
+               << std::fixed << std::setprecision(2) << fuera / dentro << std::defaultfloat << " desde n = " << primero->n << std::endl;
+    }
+}
+
+#endif
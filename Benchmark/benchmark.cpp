@@ -0,0 +1,37 @@
+#include <iostream>
+#include <cstdlib>
+#include <ctime>
+#include "benchmark.h"
+#include "algoritmos.h"
+
+using namespace std;
+
+/**
+ * @brief Función principal que mide todos los algoritmos registrados sobre todas las entradas estándar.
+ *
+ * Ejemplos:
+ *   ./benchmark --repeticiones 10 --formato csv --salida resultados.csv
+ *   ./benchmark --filtro "Quick Sort"
+ *
+ * @return int Código de estado de la ejecución.
+ */
+int main(int argc, char* argv[]) {
+    // Semilla para la función rand() usada por la partición de Quick Sort
+    srand(time(0));
+
+    RegistroBenchmark registro;
+    registrarAlgoritmosOrdenamiento(registro);
+    registrarAlgoritmosSeleccion(registro);
+    registrarAlgoritmosMatrices(registro);
+    agregarEntradasEstandar(registro);
+    agregarTopKEnFlujo(registro, archivosOrdenamiento());
+    agregarMultiplicacionDispersa(registro, casosMatricesDispersas());
+    agregarMultiplicacionPorLotes(registro);
+    agregarCadenasMatrices(registro);
+    agregarTranspuestas(registro, casosMatrices());
+    agregarMultiplicacionFueraDeMemoria(registro, casosMatrices());
+    agregarMemoriaParalela(registro, archivosOrdenamiento(), casosMatrices());
+    agregarDatasetsComprimidos(registro, archivosOrdenamiento());
+
+    return ejecutarBenchmark(registro, argc, argv);
+}
@@ -0,0 +1,954 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <functional>
+#include <memory>
+#include <chrono>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstdio>
+#include <filesystem>
+#include "../Data_sets/datasets.h"
+#include "../Data_sets/cache_datasets.h"
+#include "../Data_sets/comprimido.h"
+#include "contadores.h"
+#include "memoria.h"
+#include "verificacion.h"
+#include "regresion.h"
+#include "barrido.h"
+#include "precarga.h"
+
+/**
+ * @brief Una combinación algoritmo x dataset lista para medirse.
+ *
+ * 'preparar' se ejecuta antes de cada repetición fuera de la región medida (por ejemplo,
+ * para restaurar una copia del dataset original); sólo 'ejecutar' se cronometra.
+ * 'verificar', si existe, comprueba el resultado de la última repetición sin medirse.
+ */
+struct Prueba {
+    std::string algoritmo;
+    std::string dataset;
+    double trabajo = 0;          // Unidades de trabajo por repetición (elementos, GFLOP, ...)
+    std::string unidad;          // Unidad del rendimiento: trabajo por segundo
+    std::function<void()> preparar;
+    std::function<void()> ejecutar;
+    std::function<bool()> verificar;
+    std::function<bool(const std::string& archivo)> guardar;  // Si existe, guarda el resultado de la última repetición
+};
+
+/**
+ * @brief Conjunto de pruebas que comparten una misma entrada.
+ *
+ * 'cargar' lee la entrada (fuera de toda medición) y construye las pruebas que la usan;
+ * la entrada se libera cuando se terminan de medir.
+ */
+struct GrupoPruebas {
+    std::string dataset;
+    std::function<std::vector<Prueba>()> cargar;
+};
+
+/**
+ * @brief Parámetros de ejecución del benchmark, leídos desde la línea de comandos.
+ */
+struct OpcionesBenchmark {
+    int calentamiento = 1;          // Repeticiones descartadas antes de medir
+    int repeticiones = 5;           // Repeticiones medidas
+    std::string formato = "texto";  // texto | csv | json
+    std::string salida;             // Archivo para csv/json (vacío: salida estándar)
+    std::string filtro;             // Sólo pruebas cuyo algoritmo o dataset contenga este texto
+    bool contadores = false;        // Medir contadores de hardware alrededor de cada repetición
+    bool memoria = false;           // Medir asignaciones y picos de memoria de cada repetición
+    bool verificar = true;          // Comprobar el resultado de cada prueba (fuera de la medición)
+    bool precarga = precargaPorDefecto();  // Cargar el siguiente grupo en otro hilo mientras se mide el actual
+    std::string guardarComprimido;  // Directorio donde guardar comprimidos los resultados de los ordenamientos
+    OpcionesRegresion regresion;    // Guardar o comparar con la línea base de la máquina
+    OpcionesBarrido barrido;        // Medir sobre entradas generadas de tamaños crecientes
+};
+
+/**
+ * @brief Estadísticas de las repeticiones de una prueba (todas en milisegundos).
+ */
+struct ResultadoBenchmark {
+    std::string algoritmo;
+    std::string dataset;
+    std::vector<double> muestras;
+    double minimo = 0;
+    double mediana = 0;
+    double p95 = 0;
+    double media = 0;
+    double desviacion = 0;
+    double rendimiento = 0;  // Trabajo por segundo calculado con la mediana
+    std::string unidad;
+    LecturaContadores contadores = contadoresNoDisponibles();  // Mediana por repetición de cada contador
+    LecturaMemoria memoria = memoriaNoDisponible();             // Mediana por repetición de cada magnitud de memoria
+    std::string verificacion;  // "correcto", "INCORRECTO" o vacío si no se verificó
+};
+
+/**
+ * @brief Calcula mínimo, mediana, percentil 95, media y desviación estándar muestral.
+ *
+ * @param resultado Resultado cuyas 'muestras' ya están cargadas.
+ */
+inline void calcularEstadisticas(ResultadoBenchmark& resultado) {
+    std::vector<double> ordenadas = resultado.muestras;
+    std::sort(ordenadas.begin(), ordenadas.end());
+    size_t n = ordenadas.size();
+    if (n == 0) {
+        return;
+    }
+
+    resultado.minimo = ordenadas.front();
+    resultado.mediana = n % 2 == 1 ? ordenadas[n / 2] : (ordenadas[n / 2 - 1] + ordenadas[n / 2]) / 2;
+
+    // Percentil 95 por rango más cercano
+    size_t rango = static_cast<size_t>(std::ceil(0.95 * n));
+    resultado.p95 = ordenadas[std::max<size_t>(rango, 1) - 1];
+
+    double suma = 0;
+    for (double muestra : ordenadas) {
+        suma += muestra;
+    }
+    resultado.media = suma / n;
+
+    double sumaCuadrados = 0;
+    for (double muestra : ordenadas) {
+        sumaCuadrados += (muestra - resultado.media) * (muestra - resultado.media);
+    }
+    resultado.desviacion = n > 1 ? std::sqrt(sumaCuadrados / (n - 1)) : 0;
+}
+
+/**
+ * @brief Registro de algoritmos y entradas. Cada programa registra lo que quiere medir.
+ */
+class RegistroBenchmark {
+public:
+    using Ordenador = std::function<void(std::vector<int>&)>;
+    using Multiplicador = std::function<std::vector<std::vector<int>>(const std::vector<std::vector<int>>&, const std::vector<std::vector<int>>&)>;
+    using Verificador = std::function<bool(const ChecksumMulticonjunto& original, const std::vector<int>& resultado)>;
+
+    /**
+     * @brief Registra un algoritmo de ordenamiento que se medirá sobre cada dataset de enteros.
+     *
+     * Su resultado se verifica comprobando que está ordenado y que conserva el multiconjunto.
+     */
+    void registrarOrdenamiento(const std::string& nombre, Ordenador algoritmo) {
+        ordenadores.push_back({nombre, std::move(algoritmo), verificarOrdenamiento, true});
+    }
+
+    /**
+     * @brief Registra otra operación sobre los datasets de enteros (por ejemplo, una selección).
+     *
+     * @param verificador Comprobación del resultado (vacía: no se verifica).
+     */
+    void registrarOperacion(const std::string& nombre, Ordenador operacion, Verificador verificador = nullptr) {
+        ordenadores.push_back({nombre, std::move(operacion), std::move(verificador), false});
+    }
+
+    /**
+     * @brief Registra un algoritmo de multiplicación que se medirá sobre cada caso de matrices.
+     */
+    void registrarMultiplicacion(const std::string& nombre, Multiplicador algoritmo) {
+        multiplicadores.push_back({nombre, std::move(algoritmo)});
+    }
+
+    void agregarDatasetOrdenamiento(const std::string& archivo) {
+        archivos.push_back(archivo);
+    }
+
+    void agregarCasoMatrices(const CasoMatrices& caso) {
+        casos.push_back(caso);
+    }
+
+    /**
+     * @brief Agrega un grupo de pruebas arbitrario (entradas generadas, modos especiales, ...).
+     */
+    void agregarGrupo(GrupoPruebas grupo) {
+        adicionales.push_back(std::move(grupo));
+    }
+
+    /**
+     * @brief Construye los grupos de pruebas: datasets de enteros, casos de matrices y grupos adicionales.
+     */
+    std::vector<GrupoPruebas> grupos() const {
+        std::vector<GrupoPruebas> resultado;
+
+        if (!ordenadores.empty()) {
+            for (const std::string& archivo : archivos) {
+                resultado.push_back({obtenerDescripcionDataset(archivo), [this, archivo]() {
+                    return pruebasOrdenamiento(archivo);
+                }});
+            }
+        }
+
+        if (!multiplicadores.empty()) {
+            for (const CasoMatrices& caso : casos) {
+                resultado.push_back({descripcionCaso(caso), [this, caso]() {
+                    return pruebasMatrices(caso);
+                }});
+            }
+        }
+
+        resultado.insert(resultado.end(), adicionales.begin(), adicionales.end());
+        return resultado;
+    }
+
+    /**
+     * @brief Descripción de un caso de matrices, p. ej. "100x500 y 500x1000" o "1000x1000 y 1000x1000 al 5%".
+     */
+    static std::string descripcionCaso(const CasoMatrices& caso) {
+        std::string descripcion = std::to_string(caso.filasA) + "x" + std::to_string(caso.columnasA) + " y " +
+                                  std::to_string(caso.columnasA) + "x" + std::to_string(caso.columnasB);
+        if (caso.densidad < 100) {
+            descripcion += " al " + std::to_string(caso.densidad) + "%";
+        }
+        return descripcion;
+    }
+
+    /**
+     * @brief Pruebas de todos los ordenamientos y operaciones registrados sobre una entrada ya cargada.
+     */
+    std::vector<Prueba> pruebasOrdenamiento(std::shared_ptr<const std::vector<int>> original, const std::string& descripcion) const {
+        std::vector<Prueba> pruebas;
+
+        // La huella del original se calcula una sola vez, fuera de toda medición
+        ChecksumMulticonjunto checksum = checksumMulticonjunto(*original);
+
+        for (const EntradaOrdenador& entrada : ordenadores) {
+            auto datos = std::make_shared<std::vector<int>>();
+            Ordenador algoritmo = entrada.algoritmo;
+
+            Prueba prueba;
+            prueba.algoritmo = entrada.nombre;
+            prueba.dataset = descripcion;
+            prueba.trabajo = static_cast<double>(original->size());
+            prueba.unidad = "elem/s";
+            // Cada repetición parte de una copia del dataset original
+            prueba.preparar = [datos, original]() { *datos = *original; };
+            prueba.ejecutar = [datos, algoritmo]() { algoritmo(*datos); };
+            if (entrada.verificador) {
+                Verificador verificador = entrada.verificador;
+                prueba.verificar = [datos, checksum, verificador]() { return verificador(checksum, *datos); };
+            }
+            if (entrada.ordena) {
+                prueba.guardar = [datos](const std::string& archivo) { return guardarDatasetComprimido(*datos, archivo); };
+            }
+            pruebas.push_back(std::move(prueba));
+        }
+
+        return pruebas;
+    }
+
+    /**
+     * @brief Pruebas de todos los multiplicadores registrados sobre dos matrices ya cargadas.
+     */
+    std::vector<Prueba> pruebasMatrices(std::shared_ptr<const std::vector<std::vector<int>>> A,
+                                        std::shared_ptr<const std::vector<std::vector<int>>> B, const std::string& descripcion) const {
+        std::vector<Prueba> pruebas;
+        double filasA = static_cast<double>(A->size());
+        double columnasA = static_cast<double>(B->size());
+        double columnasB = B->empty() ? 0.0 : static_cast<double>((*B)[0].size());
+
+        for (const auto& entrada : multiplicadores) {
+            auto C = std::make_shared<std::vector<std::vector<int>>>();
+            Multiplicador algoritmo = entrada.second;
+
+            Prueba prueba;
+            prueba.algoritmo = entrada.first;
+            prueba.dataset = descripcion;
+            prueba.trabajo = 2.0 * filasA * columnasA * columnasB / 1e9;
+            prueba.unidad = "GFLOP/s";
+            prueba.preparar = [C]() { C->clear(); };
+            prueba.ejecutar = [A, B, C, algoritmo]() { *C = algoritmo(*A, *B); };
+            prueba.verificar = [A, B, C]() { return freivalds(*A, *B, *C); };
+            pruebas.push_back(std::move(prueba));
+        }
+
+        return pruebas;
+    }
+
+    bool tieneOrdenamientos() const {
+        return !ordenadores.empty();
+    }
+
+    bool tieneMultiplicaciones() const {
+        return !multiplicadores.empty();
+    }
+
+private:
+    struct EntradaOrdenador {
+        std::string nombre;
+        Ordenador algoritmo;
+        Verificador verificador;
+        bool ordena;  // Su resultado es el dataset ordenado (registrarOrdenamiento), no otra operación
+    };
+
+    std::vector<EntradaOrdenador> ordenadores;
+    std::vector<std::pair<std::string, Multiplicador>> multiplicadores;
+    std::vector<std::string> archivos;
+    std::vector<CasoMatrices> casos;
+    std::vector<GrupoPruebas> adicionales;
+
+    std::vector<Prueba> pruebasOrdenamiento(const std::string& archivo) const {
+        std::shared_ptr<const std::vector<int>> original = cacheDatasets().dataset(archivo);
+        std::string descripcion = obtenerDescripcionDataset(archivo);
+
+        // Verificar si el dataset contiene datos
+        if (original->empty()) {
+            std::cout << "Error: El dataset " << descripcion << " está vacío." << std::endl;
+            return {};
+        }
+        return pruebasOrdenamiento(original, descripcion);
+    }
+
+    std::vector<Prueba> pruebasMatrices(const CasoMatrices& caso) const {
+        // En los casos cuadrados A y B son el mismo archivo: se lee una vez
+        auto A = cacheDatasets().matriz(caso.archivoA, caso.filasA, caso.columnasA);
+        auto B = cacheDatasets().matriz(caso.archivoB, caso.columnasA, caso.columnasB);
+        return pruebasMatrices(A, B, descripcionCaso(caso));
+    }
+};
+
+/**
+ * @brief Mediana de cada valor (contador o magnitud de memoria) entre las repeticiones, ignorando los no disponibles.
+ */
+template <class Lectura>
+Lectura medianaLecturas(const std::vector<Lectura>& lecturas) {
+    Lectura mediana;
+    mediana.fill(-1);
+    for (size_t c = 0; c < mediana.size(); c++) {
+        std::vector<double> valores;
+        for (const Lectura& lectura : lecturas) {
+            if (lectura[c] >= 0) {
+                valores.push_back(lectura[c]);
+            }
+        }
+        if (!valores.empty()) {
+            std::sort(valores.begin(), valores.end());
+            size_t n = valores.size();
+            mediana[c] = n % 2 == 1 ? valores[n / 2] : (valores[n / 2 - 1] + valores[n / 2]) / 2;
+        }
+    }
+    return mediana;
+}
+
+/**
+ * @brief Ejecuta las repeticiones de calentamiento y las medidas de una prueba.
+ *
+ * @param prueba Prueba a medir.
+ * @param opciones Número de repeticiones de calentamiento y medidas.
+ * @param contadores Contadores de hardware a leer alrededor de cada repetición (nullptr: ninguno).
+ * @param memoria Medidor de memoria de cada repetición (nullptr: ninguno).
+ * @return ResultadoBenchmark Muestras y estadísticas.
+ */
+inline ResultadoBenchmark medirPrueba(const Prueba& prueba, const OpcionesBenchmark& opciones, ContadoresHardware* contadores = nullptr,
+                                      MedidorMemoria* memoria = nullptr) {
+    ResultadoBenchmark resultado;
+    resultado.algoritmo = prueba.algoritmo;
+    resultado.dataset = prueba.dataset;
+    resultado.unidad = prueba.unidad;
+    std::vector<LecturaContadores> lecturas;
+    std::vector<LecturaMemoria> lecturasMemoria;
+    lecturas.reserve(opciones.calentamiento + opciones.repeticiones);
+    lecturasMemoria.reserve(opciones.calentamiento + opciones.repeticiones);
+    resultado.muestras.reserve(opciones.calentamiento + opciones.repeticiones);
+
+    for (int r = 0; r < opciones.calentamiento + opciones.repeticiones; r++) {
+        if (prueba.preparar) {
+            prueba.preparar();
+        }
+
+        // Medir sólo la región de interés
+        if (memoria) {
+            memoria->iniciar();
+        }
+        if (contadores) {
+            contadores->iniciar();
+        }
+        auto inicio = std::chrono::steady_clock::now();
+        prueba.ejecutar();
+        auto fin = std::chrono::steady_clock::now();
+        LecturaContadores lectura = contadores ? contadores->detener() : contadoresNoDisponibles();
+        LecturaMemoria lecturaMemoria = memoria ? memoria->detener() : memoriaNoDisponible();
+        std::chrono::duration<double, std::milli> duracion = fin - inicio;
+
+        if (r >= opciones.calentamiento) {
+            resultado.muestras.push_back(duracion.count());
+            lecturas.push_back(lectura);
+            lecturasMemoria.push_back(lecturaMemoria);
+        }
+    }
+
+    calcularEstadisticas(resultado);
+    resultado.contadores = medianaLecturas(lecturas);
+    resultado.memoria = medianaLecturas(lecturasMemoria);
+
+    // Verificar el resultado de la última repetición, ya fuera de la región medida
+    if (opciones.verificar && prueba.verificar) {
+        resultado.verificacion = prueba.verificar() ? "correcto" : "INCORRECTO";
+    }
+    if (resultado.mediana > 0) {
+        resultado.rendimiento = prueba.trabajo / (resultado.mediana / 1000.0);
+    }
+    return resultado;
+}
+
+/**
+ * @brief Instrucciones por ciclo, o -1 si alguno de los dos contadores no está disponible.
+ */
+inline double calcularIpc(const LecturaContadores& contadores) {
+    if (contadores[CICLOS] > 0 && contadores[INSTRUCCIONES] >= 0) {
+        return contadores[INSTRUCCIONES] / contadores[CICLOS];
+    }
+    return -1;
+}
+
+/**
+ * @brief Muestra un resultado en una línea legible.
+ */
+inline void imprimirResultado(std::ostream& salida, const ResultadoBenchmark& r) {
+    salida << r.algoritmo << " de " << r.dataset << " - Tiempo: " << r.mediana << " ms"
+           << " (mín " << r.minimo << ", p95 " << r.p95 << ", desv " << r.desviacion
+           << ", " << r.muestras.size() << " rep.) - " << r.rendimiento << " " << r.unidad;
+    if (!r.verificacion.empty()) {
+        salida << " - Resultado " << r.verificacion;
+    }
+    salida << std::endl;
+
+    // Contadores de hardware, si se midieron
+    bool hayContadores = false;
+    for (double valor : r.contadores) {
+        hayContadores = hayContadores || valor >= 0;
+    }
+    if (hayContadores) {
+        salida << "    ";
+        for (int c = 0; c < NUM_CONTADORES; c++) {
+            salida << nombreContador(c) << "=";
+            if (r.contadores[c] >= 0) {
+                salida << r.contadores[c];
+            } else {
+                salida << "n/d";
+            }
+            salida << " ";
+        }
+        if (calcularIpc(r.contadores) >= 0) {
+            salida << "IPC=" << calcularIpc(r.contadores);
+        }
+        salida << std::endl;
+    }
+
+    // Memoria, si se midió
+    bool hayMemoria = false;
+    for (double valor : r.memoria) {
+        hayMemoria = hayMemoria || valor >= 0;
+    }
+    if (hayMemoria) {
+        salida << "    ";
+        for (int m = 0; m < NUM_MEMORIA; m++) {
+            salida << nombreMemoria(m) << "=";
+            if (r.memoria[m] >= 0) {
+                salida << static_cast<long long>(r.memoria[m]);
+            } else {
+                salida << "n/d";
+            }
+            salida << (m + 1 < NUM_MEMORIA ? " " : "");
+        }
+        salida << std::endl;
+    }
+}
+
+/**
+ * @brief Escapa una cadena para CSV (entre comillas dobles).
+ */
+inline std::string escaparCsv(const std::string& texto) {
+    std::string resultado = "\"";
+    for (char c : texto) {
+        if (c == '"') {
+            resultado += '"';
+        }
+        resultado += c;
+    }
+    return resultado + "\"";
+}
+
+inline void escribirCsv(std::ostream& salida, const std::vector<ResultadoBenchmark>& resultados) {
+    salida << "algoritmo,dataset,repeticiones,min_ms,mediana_ms,p95_ms,media_ms,desviacion_ms,rendimiento,unidad";
+    for (int c = 0; c < NUM_CONTADORES; c++) {
+        salida << "," << nombreContador(c);
+    }
+    for (int m = 0; m < NUM_MEMORIA; m++) {
+        salida << "," << nombreMemoria(m);
+    }
+    salida << ",ipc,verificacion\n";
+
+    for (const ResultadoBenchmark& r : resultados) {
+        salida << escaparCsv(r.algoritmo) << "," << escaparCsv(r.dataset) << "," << r.muestras.size() << ","
+               << r.minimo << "," << r.mediana << "," << r.p95 << "," << r.media << "," << r.desviacion << ","
+               << r.rendimiento << "," << escaparCsv(r.unidad);
+
+        // Los contadores y magnitudes no disponibles quedan como celdas vacías
+        for (double valor : r.contadores) {
+            salida << ",";
+            if (valor >= 0) {
+                salida << valor;
+            }
+        }
+        for (double valor : r.memoria) {
+            salida << ",";
+            if (valor >= 0) {
+                salida << static_cast<long long>(valor);
+            }
+        }
+        salida << ",";
+        if (calcularIpc(r.contadores) >= 0) {
+            salida << calcularIpc(r.contadores);
+        }
+        salida << "," << escaparCsv(r.verificacion) << "\n";
+    }
+}
+
+/**
+ * @brief Escribe las series de un barrido en CSV, un punto por fila.
+ */
+inline void escribirCsvBarrido(std::ostream& salida, const std::vector<SerieBarrido>& series) {
+    salida << "algoritmo,tipo,n,bytes_trabajo,mediana_ms,min_ms,p95_ms,rendimiento,unidad,costo_normalizado,exponente_local,exponente_ajustado,modelo\n";
+    for (const SerieBarrido& serie : series) {
+        for (const PuntoBarrido& p : serie.puntos) {
+            salida << escaparCsv(serie.algoritmo) << "," << (serie.tipo == BARRIDO_ORDENAMIENTO ? "ordenamiento" : "matrices") << ","
+                   << p.n << "," << p.bytes << "," << p.mediana << "," << p.minimo << "," << p.p95 << "," << p.rendimiento << ","
+                   << escaparCsv(serie.unidad) << "," << p.costoNormalizado << "," << p.exponenteLocal << "," << serie.exponente << ","
+                   << escaparCsv(serie.modelo) << "\n";
+        }
+    }
+}
+
+inline void escribirJson(std::ostream& salida, const std::vector<ResultadoBenchmark>& resultados) {
+    salida << "[\n";
+    for (size_t i = 0; i < resultados.size(); i++) {
+        const ResultadoBenchmark& r = resultados[i];
+        salida << "  {\"algoritmo\": " << escaparJson(r.algoritmo) << ", \"dataset\": " << escaparJson(r.dataset)
+               << ", \"min_ms\": " << r.minimo << ", \"mediana_ms\": " << r.mediana << ", \"p95_ms\": " << r.p95
+               << ", \"media_ms\": " << r.media << ", \"desviacion_ms\": " << r.desviacion
+               << ", \"rendimiento\": " << r.rendimiento << ", \"unidad\": " << escaparJson(r.unidad)
+               << ", \"verificacion\": " << (r.verificacion.empty() ? "null" : escaparJson(r.verificacion))
+               << ", \"muestras_ms\": [";
+        for (size_t m = 0; m < r.muestras.size(); m++) {
+            salida << (m > 0 ? ", " : "") << r.muestras[m];
+        }
+        salida << "], \"contadores\": {";
+        for (int c = 0; c < NUM_CONTADORES; c++) {
+            salida << (c > 0 ? ", " : "") << "\"" << nombreContador(c) << "\": ";
+            if (r.contadores[c] >= 0) {
+                salida << r.contadores[c];
+            } else {
+                salida << "null";
+            }
+        }
+        salida << "}, \"memoria\": {";
+        for (int m = 0; m < NUM_MEMORIA; m++) {
+            salida << (m > 0 ? ", " : "") << "\"" << nombreMemoria(m) << "\": ";
+            if (r.memoria[m] >= 0) {
+                salida << static_cast<long long>(r.memoria[m]);
+            } else {
+                salida << "null";
+            }
+        }
+        salida << "}}" << (i + 1 < resultados.size() ? "," : "") << "\n";
+    }
+    salida << "]\n";
+}
+
+/**
+ * @brief Muestra las opciones de línea de comandos.
+ */
+inline void mostrarAyuda(const char* programa) {
+    std::cout << "Uso: " << programa << " [opciones]\n"
+              << "  --repeticiones N    Repeticiones medidas por prueba (por defecto 5)\n"
+              << "  --calentamiento N   Repeticiones descartadas antes de medir (por defecto 1)\n"
+              << "  --formato F         texto, csv o json (por defecto texto)\n"
+              << "  --salida ARCHIVO    Archivo donde escribir el csv/json\n"
+              << "  --filtro TEXTO      Sólo pruebas cuyo algoritmo o dataset contenga TEXTO\n"
+              << "  --contadores        Medir contadores de hardware (ciclos, instrucciones, fallos de caché, saltos y dTLB)\n"
+              << "  --memoria           Medir asignaciones, bytes pedidos y picos de memoria viva y RSS (conteo con -DMEDIR_MEMORIA)\n"
+              << "  --sin-verificar     No comprobar los resultados (por defecto se comprueban fuera de la medición)\n"
+              << "  --precarga          Leer la entrada del siguiente grupo en otro hilo mientras se mide (por defecto, con más de un núcleo)\n"
+              << "  --sin-precarga      Leer cada entrada justo antes de medirla\n"
+              << "  --guardar-comprimido DIR  Guardar en DIR el resultado de cada ordenamiento en el formato comprimido (.dcmp)\n"
+              << "  --guardar-base      Guardar las muestras como línea base de esta máquina y compilación\n"
+              << "  --comparar-base     Comparar con la línea base (Mann-Whitney); código 2 si hay regresiones\n"
+              << "  --bases DIR         Directorio de las líneas base (por defecto lineas_base)\n"
+              << "  --umbral P          Aumento mínimo de la mediana, en %, para una regresión (por defecto 5)\n"
+              << "  --minimo-ms T       No comparar los pares cuya mediana base baje de T ms (por defecto 0.05)\n"
+              << "  --alfa A            Nivel de significación de la comparación en conjunto, no por par (Holm-Bonferroni; por defecto 0.05)\n"
+              << "  --barrido           Medir sobre entradas generadas de tamaños en progresión geométrica y ajustar la complejidad\n"
+              << "  --desde N           Tamaño inicial del barrido (por defecto 1000 enteros o matrices de 16x16)\n"
+              << "  --hasta N           Tamaño final del barrido (por defecto 4000000 enteros o matrices de 1024x1024)\n"
+              << "  --factor F          Razón entre tamaños consecutivos del barrido (por defecto 1.5)\n"
+              << "  --limite-ms T       Un algoritmo deja de crecer en el barrido al superar T ms (por defecto 1000)\n";
+}
+
+/**
+ * @brief Resultado de interpretar la línea de comandos.
+ */
+enum ResultadoOpciones {
+    OPCIONES_VALIDAS,
+    OPCIONES_INVALIDAS,
+    AYUDA_MOSTRADA
+};
+
+/**
+ * @brief Interpreta los argumentos de la línea de comandos.
+ *
+ * @param opciones Opciones a completar.
+ * @return ResultadoOpciones Si se puede medir, si hay un argumento inválido o si sólo se pidió la ayuda.
+ */
+inline ResultadoOpciones leerOpciones(int argc, char* argv[], OpcionesBenchmark& opciones) {
+    for (int i = 1; i < argc; i++) {
+        std::string argumento = argv[i];
+        bool tieneValor = i + 1 < argc;
+
+        if (argumento == "--repeticiones" && tieneValor) {
+            opciones.repeticiones = std::max(1, std::atoi(argv[++i]));
+        } else if (argumento == "--calentamiento" && tieneValor) {
+            opciones.calentamiento = std::max(0, std::atoi(argv[++i]));
+        } else if (argumento == "--formato" && tieneValor) {
+            opciones.formato = argv[++i];
+            if (opciones.formato != "texto" && opciones.formato != "csv" && opciones.formato != "json") {
+                std::cerr << "Error: formato desconocido '" << opciones.formato << "'." << std::endl;
+                return OPCIONES_INVALIDAS;
+            }
+        } else if (argumento == "--salida" && tieneValor) {
+            opciones.salida = argv[++i];
+        } else if (argumento == "--filtro" && tieneValor) {
+            opciones.filtro = argv[++i];
+        } else if (argumento == "--contadores") {
+            opciones.contadores = true;
+        } else if (argumento == "--memoria") {
+            opciones.memoria = true;
+        } else if (argumento == "--sin-verificar") {
+            opciones.verificar = false;
+        } else if (argumento == "--precarga") {
+            opciones.precarga = true;
+        } else if (argumento == "--sin-precarga") {
+            opciones.precarga = false;
+        } else if (argumento == "--guardar-comprimido" && tieneValor) {
+            opciones.guardarComprimido = argv[++i];
+        } else if (argumento == "--guardar-base") {
+            opciones.regresion.guardar = true;
+        } else if (argumento == "--comparar-base") {
+            opciones.regresion.comparar = true;
+        } else if (argumento == "--bases" && tieneValor) {
+            opciones.regresion.directorio = argv[++i];
+        } else if (argumento == "--umbral" && tieneValor) {
+            opciones.regresion.umbral = std::max(0.0, std::atof(argv[++i]));
+        } else if (argumento == "--minimo-ms" && tieneValor) {
+            opciones.regresion.minimoMs = std::max(0.0, std::atof(argv[++i]));
+        } else if (argumento == "--barrido") {
+            opciones.barrido.activo = true;
+        } else if (argumento == "--desde" && tieneValor) {
+            opciones.barrido.desde = std::max(1LL, std::atoll(argv[++i]));
+        } else if (argumento == "--hasta" && tieneValor) {
+            opciones.barrido.hasta = std::max(1LL, std::atoll(argv[++i]));
+        } else if (argumento == "--factor" && tieneValor) {
+            opciones.barrido.factor = std::atof(argv[++i]);
+            if (opciones.barrido.factor <= 1) {
+                std::cerr << "Error: el factor del barrido debe ser mayor que 1." << std::endl;
+                return OPCIONES_INVALIDAS;
+            }
+        } else if (argumento == "--limite-ms" && tieneValor) {
+            opciones.barrido.limiteMs = std::atof(argv[++i]);
+        } else if (argumento == "--alfa" && tieneValor) {
+            opciones.regresion.alfa = std::atof(argv[++i]);
+            if (opciones.regresion.alfa <= 0 || opciones.regresion.alfa >= 1) {
+                std::cerr << "Error: alfa debe estar entre 0 y 1." << std::endl;
+                return OPCIONES_INVALIDAS;
+            }
+        } else {
+            mostrarAyuda(argv[0]);
+            if (argumento == "--ayuda") {
+                return AYUDA_MOSTRADA;
+            }
+            std::cerr << "Error: argumento desconocido '" << argumento << "'." << std::endl;
+            return OPCIONES_INVALIDAS;
+        }
+    }
+    return OPCIONES_VALIDAS;
+}
+
+/**
+ * @brief Nombre de archivo a partir de un texto: lo que no sea letra o dígito ASCII pasa a ser '_'.
+ */
+inline std::string nombreArchivoSeguro(const std::string& texto) {
+    std::string nombre;
+    for (char c : texto) {
+        bool valido = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9');
+        char caracter = valido ? c : '_';
+        if (caracter != '_' || nombre.empty() || nombre.back() != '_') {
+            nombre += caracter;
+        }
+    }
+    return nombre;
+}
+
+/**
+ * @brief Guarda el resultado de la última repetición de una prueba en directorio/<algoritmo>__<dataset>.dcmp.
+ */
+inline void guardarResultadoComprimido(const Prueba& prueba, const std::string& directorio) {
+    std::error_code error;
+    std::filesystem::create_directories(directorio, error);
+    std::string archivo = directorio + "/" + nombreArchivoSeguro(prueba.algoritmo) + "__" + nombreArchivoSeguro(prueba.dataset) + ".dcmp";
+    if (!prueba.guardar(archivo)) {
+        std::cerr << "Aviso: no se pudo guardar " << archivo << "." << std::endl;
+    }
+}
+
+/**
+ * @brief Mide todas las pruebas del registro y escribe el informe en el formato pedido.
+ *
+ * @param registro Algoritmos y entradas registrados por el programa.
+ * @param opciones Opciones de ejecución.
+ * @return std::vector<ResultadoBenchmark> Resultados en el orden en que se midieron.
+ */
+inline std::vector<ResultadoBenchmark> ejecutarPruebas(const RegistroBenchmark& registro, const OpcionesBenchmark& opciones) {
+    std::vector<ResultadoBenchmark> resultados;
+
+    // Si el csv/json va a la salida estándar, no mezclarlo con las líneas de texto
+    bool mostrarTexto = opciones.formato == "texto" || !opciones.salida.empty();
+
+    // Los contadores se abren una sola vez; si el entorno no los permite se sigue sólo con el tiempo
+    std::unique_ptr<ContadoresHardware> contadores;
+    if (opciones.contadores) {
+        contadores.reset(new ContadoresHardware());
+        if (!contadores->disponible()) {
+            std::cerr << "Aviso: contadores de hardware no disponibles (" << contadores->motivo() << "); se mide sólo el tiempo." << std::endl;
+            contadores.reset();
+        } else if (!contadores->motivo().empty()) {
+            std::cerr << "Aviso: algunos contadores de hardware no están disponibles (" << contadores->motivo() << ")." << std::endl;
+        }
+    }
+
+    std::unique_ptr<MedidorMemoria> memoria;
+    if (opciones.memoria) {
+        memoria.reset(new MedidorMemoria());
+        if (!memoria->motivo().empty()) {
+            std::cerr << "Aviso: " << memoria->motivo() << "." << std::endl;
+        }
+    }
+
+    // Con --memoria no se precarga: las asignaciones y el RSS del hilo de carga se
+    // contarían como parte de la región medida
+    std::vector<GrupoPruebas> grupos = registro.grupos();
+    bool precargar = opciones.precarga && !opciones.memoria;
+    CargadorGrupos<GrupoPruebas> cargador(grupos, precargar);
+    while (cargador.quedan()) {
+        for (const Prueba& prueba : cargador.siguiente()) {
+            if (!opciones.filtro.empty() && prueba.algoritmo.find(opciones.filtro) == std::string::npos &&
+                prueba.dataset.find(opciones.filtro) == std::string::npos) {
+                continue;
+            }
+
+            resultados.push_back(medirPrueba(prueba, opciones, contadores.get(), memoria.get()));
+            if (mostrarTexto) {
+                imprimirResultado(std::cout, resultados.back());
+            }
+            if (!opciones.guardarComprimido.empty() && prueba.guardar) {
+                guardarResultadoComprimido(prueba, opciones.guardarComprimido);
+            }
+        }
+    }
+
+    if (mostrarTexto) {
+        std::cout << "Entradas: " << cacheDatasets().lecturas() << " archivos leídos, " << cacheDatasets().aciertos()
+                  << " reutilizados; " << cargador.esperaMs() << " ms de espera por la carga ("
+                  << (precargar ? "con precarga" : "sin precarga") << ")" << std::endl;
+    }
+    return resultados;
+}
+
+/**
+ * @brief Mide los ordenamientos y multiplicaciones registrados sobre entradas generadas de tamaño creciente.
+ *
+ * Los grupos adicionales (lotes, cadenas, transpuestas...) no tienen un tamaño único y no
+ * se barren. Cada algoritmo se deja de medir en cuanto su mediana supera el límite.
+ *
+ * @param incorrectos Se incrementa por cada medición con resultado incorrecto.
+ * @return std::vector<SerieBarrido> Una serie por algoritmo, ya ajustada.
+ */
+inline std::vector<SerieBarrido> ejecutarBarrido(const RegistroBenchmark& registro, const OpcionesBenchmark& opciones, int& incorrectos) {
+    std::vector<SerieBarrido> series;
+    bool mostrarTexto = opciones.formato == "texto" || !opciones.salida.empty();
+
+    for (TipoBarrido tipo : {BARRIDO_ORDENAMIENTO, BARRIDO_MATRICES}) {
+        if (tipo == BARRIDO_ORDENAMIENTO ? !registro.tieneOrdenamientos() : !registro.tieneMultiplicaciones()) {
+            continue;
+        }
+        long long desde, hasta;
+        rangoBarrido(tipo, desde, hasta);
+        desde = opciones.barrido.desde > 0 ? opciones.barrido.desde : desde;
+        hasta = opciones.barrido.hasta > 0 ? opciones.barrido.hasta : hasta;
+
+        size_t primeraSerie = series.size();
+        std::vector<std::string> terminados;
+        for (long long n : tamanosGeometricos(desde, hasta, opciones.barrido.factor)) {
+            std::vector<Prueba> pruebas;
+            if (tipo == BARRIDO_ORDENAMIENTO) {
+                auto datos = std::make_shared<const std::vector<int>>(generarDatosBarrido(n));
+                pruebas = registro.pruebasOrdenamiento(datos, std::to_string(n) + " enteros generados");
+            } else {
+                int lado = static_cast<int>(n);
+                auto A = std::make_shared<const std::vector<std::vector<int>>>(generarMatrizBarrido(lado, lado, 1));
+                auto B = std::make_shared<const std::vector<std::vector<int>>>(generarMatrizBarrido(lado, lado, 2));
+                pruebas = registro.pruebasMatrices(A, B, std::to_string(n) + "x" + std::to_string(n) + " generadas");
+            }
+
+            bool quedan = false;
+            for (const Prueba& prueba : pruebas) {
+                if ((!opciones.filtro.empty() && prueba.algoritmo.find(opciones.filtro) == std::string::npos) ||
+                    std::find(terminados.begin(), terminados.end(), prueba.algoritmo) != terminados.end()) {
+                    continue;
+                }
+                quedan = true;
+
+                ResultadoBenchmark r = medirPrueba(prueba, opciones);
+                if (mostrarTexto) {
+                    imprimirResultado(std::cout, r);
+                }
+                if (r.verificacion == "INCORRECTO") {
+                    incorrectos++;
+                }
+
+                auto serie = std::find_if(series.begin() + primeraSerie, series.end(), [&](const SerieBarrido& s) {
+                    return s.algoritmo == prueba.algoritmo;
+                });
+                if (serie == series.end()) {
+                    series.push_back({prueba.algoritmo, tipo, prueba.unidad, {}, 0, ""});
+                    serie = series.end() - 1;
+                }
+                PuntoBarrido punto;
+                punto.n = n;
+                punto.bytes = bytesTrabajo(tipo, n);
+                punto.mediana = r.mediana;
+                punto.minimo = r.minimo;
+                punto.p95 = r.p95;
+                punto.rendimiento = r.rendimiento;
+                serie->puntos.push_back(punto);
+
+                if (r.mediana > opciones.barrido.limiteMs) {
+                    terminados.push_back(prueba.algoritmo);
+                }
+            }
+            if (!quedan) {
+                break;
+            }
+        }
+    }
+
+    for (SerieBarrido& serie : series) {
+        ajustarSerie(serie);
+    }
+    return series;
+}
+
+/**
+ * @brief Punto de entrada común de los programas: lee las opciones, mide y reporta.
+ *
+ * @return int Código de estado de la ejecución: 1 si un argumento es inválido, algún resultado es
+ *             incorrecto o falta la línea base pedida, 2 si la comparación con la línea base
+ *             encontró regresiones (0 también tras mostrar la ayuda).
+ */
+inline int ejecutarBenchmark(const RegistroBenchmark& registro, int argc, char* argv[]) {
+    OpcionesBenchmark opciones;
+    ResultadoOpciones lectura = leerOpciones(argc, argv, opciones);
+    if (lectura != OPCIONES_VALIDAS) {
+        return lectura == AYUDA_MOSTRADA ? 0 : 1;
+    }
+
+    if (opciones.barrido.activo) {
+        if (opciones.formato == "json") {
+            std::cerr << "Error: el barrido se exporta en texto o csv." << std::endl;
+            return 1;
+        }
+        int incorrectos = 0;
+        std::vector<SerieBarrido> series = ejecutarBarrido(registro, opciones, incorrectos);
+
+        std::ostream& informe = opciones.formato == "texto" || !opciones.salida.empty() ? std::cout : std::cerr;
+        std::vector<NivelCache> niveles = nivelesCache();
+        for (const SerieBarrido& serie : series) {
+            imprimirAjuste(informe, serie, niveles);
+        }
+
+        if (opciones.formato == "csv") {
+            std::ofstream archivo;
+            if (!opciones.salida.empty()) {
+                archivo.open(opciones.salida);
+                if (!archivo) {
+                    std::cerr << "Error: no se pudo abrir " << opciones.salida << "." << std::endl;
+                    return 1;
+                }
+            }
+            escribirCsvBarrido(opciones.salida.empty() ? std::cout : archivo, series);
+        }
+        return incorrectos > 0 ? 1 : 0;
+    }
+
+    std::vector<ResultadoBenchmark> resultados = ejecutarPruebas(registro, opciones);
+
+    // Un algoritmo rápido pero incorrecto hace fallar el benchmark
+    int estado = 0;
+    for (const ResultadoBenchmark& r : resultados) {
+        if (r.verificacion == "INCORRECTO") {
+            std::cerr << "Error: " << r.algoritmo << " de " << r.dataset << " produjo un resultado incorrecto." << std::endl;
+            estado = 1;
+        }
+    }
+
+    if (opciones.regresion.guardar || opciones.regresion.comparar) {
+        std::vector<MedicionBase> mediciones;
+        for (const ResultadoBenchmark& r : resultados) {
+            if (r.verificacion != "INCORRECTO") {
+                mediciones.push_back({r.algoritmo, r.dataset, r.unidad, r.muestras});
+            }
+        }
+
+        // El informe no se mezcla con un csv/json que vaya a la salida estándar
+        std::ostream& informe = opciones.formato == "texto" || !opciones.salida.empty() ? std::cout : std::cerr;
+        if (opciones.regresion.comparar) {
+            int regresiones = compararConLineaBase(mediciones, opciones.regresion, informe);
+            if (regresiones < 0) {
+                estado = 1;
+            } else if (regresiones > 0 && estado == 0) {
+                estado = 2;
+            }
+        }
+        if (opciones.regresion.guardar && !guardarLineaBase(mediciones, opciones.regresion, informe)) {
+            estado = 1;
+        }
+    }
+
+    if (opciones.formato == "texto") {
+        return estado;
+    }
+
+    std::ofstream archivo;
+    if (!opciones.salida.empty()) {
+        archivo.open(opciones.salida);
+        if (!archivo) {
+            std::cerr << "Error: no se pudo abrir " << opciones.salida << "." << std::endl;
+            return 1;
+        }
+    }
+    std::ostream& salida = opciones.salida.empty() ? std::cout : archivo;
+
+    if (opciones.formato == "csv") {
+        escribirCsv(salida, resultados);
+    } else {
+        escribirJson(salida, resultados);
+    }
+    return estado;
+}
+
+#endif
@@ -0,0 +1,177 @@
+#ifndef CONTADORES_H
+#define CONTADORES_H
+
+#include <array>
+#include <string>
+#include <cstdint>
+#include <cstring>
+#include <cerrno>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @brief Eventos de hardware que se miden alrededor de cada región cronometrada.
+ */
+enum Contador {
+    CICLOS,
+    INSTRUCCIONES,
+    FALLOS_L1,
+    FALLOS_LLC,
+    FALLOS_SALTO,
+    FALLOS_DTLB,
+    NUM_CONTADORES
+};
+
+/**
+ * @brief Nombre corto de cada contador, usado como columna en CSV/JSON.
+ */
+inline const char* nombreContador(int contador) {
+    static const char* nombres[NUM_CONTADORES] = {
+        "ciclos", "instrucciones", "fallos_l1d", "fallos_llc", "fallos_salto", "fallos_dtlb"
+    };
+    return nombres[contador];
+}
+
+/**
+ * @brief Valores de una medición; -1 indica que el contador no está disponible.
+ */
+using LecturaContadores = std::array<double, NUM_CONTADORES>;
+
+/**
+ * @brief Lectura con todos los contadores marcados como no disponibles.
+ */
+inline LecturaContadores contadoresNoDisponibles() {
+    LecturaContadores lectura;
+    lectura.fill(-1);
+    return lectura;
+}
+
+/**
+ * @brief Contadores de rendimiento de hardware mediante perf_event_open (sólo Linux).
+ *
+ * Cada evento se abre por separado, de modo que si el núcleo o el contenedor no
+ * permite alguno (perf_event_paranoid, máquinas virtuales, seccomp) los demás se
+ * siguen midiendo. Si ninguno está disponible, 'disponible()' devuelve false y las
+ * lecturas son todas -1. Los valores se escalan si el núcleo multiplexó los eventos, y
+ * un evento que el núcleo no llegó a planificar se lee como -1.
+ *
+ * Sólo se cuenta el hilo que crea el objeto (pid 0, sin 'inherit'): el trabajo que hacen
+ * otros hilos, como los de GrupoHilos o std::async en los núcleos paralelos, no aparece.
+ */
+class ContadoresHardware {
+public:
+    ContadoresHardware() {
+        descriptores.fill(-1);
+#ifdef __linux__
+        const uint64_t cache = PERF_COUNT_HW_CACHE_OP_READ << 8 | PERF_COUNT_HW_CACHE_RESULT_MISS << 16;
+        abrir(CICLOS, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+        abrir(INSTRUCCIONES, PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+        abrir(FALLOS_L1, PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | cache);
+        abrir(FALLOS_LLC, PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_LL | cache);
+        abrir(FALLOS_SALTO, PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+        abrir(FALLOS_DTLB, PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_DTLB | cache);
+#else
+        error = "perf_event_open sólo existe en Linux";
+#endif
+    }
+
+    ~ContadoresHardware() {
+#ifdef __linux__
+        for (int fd : descriptores) {
+            if (fd >= 0) {
+                close(fd);
+            }
+        }
+#endif
+    }
+
+    ContadoresHardware(const ContadoresHardware&) = delete;
+    ContadoresHardware& operator=(const ContadoresHardware&) = delete;
+
+    /**
+     * @brief true si al menos un contador se pudo abrir.
+     */
+    bool disponible() const {
+        for (int fd : descriptores) {
+            if (fd >= 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Motivo por el que el primer contador no se pudo abrir (vacío si todos se abrieron).
+     */
+    const std::string& motivo() const {
+        return error;
+    }
+
+    /**
+     * @brief Pone a cero y activa todos los contadores abiertos.
+     */
+    void iniciar() {
+#ifdef __linux__
+        for (int fd : descriptores) {
+            if (fd >= 0) {
+                ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+                ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+            }
+        }
+#endif
+    }
+
+    /**
+     * @brief Detiene los contadores y devuelve sus valores.
+     */
+    LecturaContadores detener() {
+        LecturaContadores lectura = contadoresNoDisponibles();
+#ifdef __linux__
+        for (int fd : descriptores) {
+            if (fd >= 0) {
+                ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+            }
+        }
+        for (int c = 0; c < NUM_CONTADORES; c++) {
+            // Formato: valor, tiempo habilitado, tiempo en ejecución
+            uint64_t valores[3];
+            // Un evento que nunca llegó a ejecutarse (tiempo en ejecución 0) no tiene valor
+            if (descriptores[c] >= 0 && read(descriptores[c], valores, sizeof(valores)) == sizeof(valores) && valores[2] > 0) {
+                lectura[c] = valores[0] * (static_cast<double>(valores[1]) / valores[2]);
+            }
+        }
+#endif
+        return lectura;
+    }
+
+private:
+    std::array<int, NUM_CONTADORES> descriptores;
+    std::string error;
+
+#ifdef __linux__
+    void abrir(int contador, uint32_t tipo, uint64_t configuracion) {
+        perf_event_attr atributos;
+        std::memset(&atributos, 0, sizeof(atributos));
+        atributos.size = sizeof(atributos);
+        atributos.type = tipo;
+        atributos.config = configuracion;
+        atributos.disabled = 1;
+        atributos.exclude_kernel = 1;  // Permitido con perf_event_paranoid <= 2
+        atributos.exclude_hv = 1;
+        atributos.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+        long fd = syscall(SYS_perf_event_open, &atributos, 0, -1, -1, 0);
+        descriptores[contador] = static_cast<int>(fd);
+        if (fd < 0 && error.empty()) {
+            error = std::string(nombreContador(contador)) + ": " + std::strerror(errno);
+        }
+    }
+#endif
+};
+
+#endif
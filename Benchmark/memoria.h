@@ -0,0 +1,239 @@
+#ifndef MEMORIA_H
+#define MEMORIA_H
+
+#include <array>
+#include <atomic>
+#include <string>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+// Instrumentación de memoria de las regiones medidas (--memoria). El pico de RSS se lee
+// siempre de /proc; el número de asignaciones, los bytes pedidos y el pico de memoria viva
+// requieren compilar con -DMEDIR_MEMORIA, que reemplaza los operator new/delete globales
+// por versiones que cuentan. Como los reemplazos se definen en este encabezado, la macro
+// debe estar en una sola unidad de traducción (cada programa es un único .cpp).
+
+/**
+ * @brief Magnitudes de memoria de una región medida.
+ */
+enum Memoria {
+    ASIGNACIONES,  // Llamadas a operator new
+    BYTES_PEDIDOS, // Suma de los tamaños pedidos
+    PICO_VIVO,     // Máximo de bytes vivos por encima de los que había al empezar la región
+    PICO_RSS,      // Máximo de memoria residente del proceso durante la región
+    NUM_MEMORIA
+};
+
+/**
+ * @brief Nombre corto de cada magnitud, usado como columna en CSV/JSON.
+ */
+inline const char* nombreMemoria(int magnitud) {
+    static const char* nombres[NUM_MEMORIA] = {"asignaciones", "bytes_pedidos", "pico_vivo_bytes", "pico_rss_bytes"};
+    return nombres[magnitud];
+}
+
+/**
+ * @brief Valores de una medición; -1 indica que la magnitud no está disponible.
+ */
+using LecturaMemoria = std::array<double, NUM_MEMORIA>;
+
+inline LecturaMemoria memoriaNoDisponible() {
+    LecturaMemoria lectura;
+    lectura.fill(-1);
+    return lectura;
+}
+
+/**
+ * @brief Contadores globales que actualizan los operator new/delete reemplazados.
+ */
+struct ConteoAsignaciones {
+    std::atomic<uint64_t> asignaciones{0};
+    std::atomic<uint64_t> bytes{0};
+    std::atomic<int64_t> vivos{0};
+    std::atomic<int64_t> pico{0};
+};
+
+inline ConteoAsignaciones& conteoAsignaciones() {
+    static ConteoAsignaciones conteo;
+    return conteo;
+}
+
+#ifdef MEDIR_MEMORIA
+const bool CONTEO_ASIGNACIONES = true;
+
+const std::size_t CABECERA_ASIGNACION = 16;  // Guarda el tamaño pedido sin romper la alineación de malloc
+
+/**
+ * @brief Registra una asignación de 'tamano' bytes y actualiza el pico de memoria viva.
+ */
+inline void registrarAsignacion(std::size_t tamano) {
+    ConteoAsignaciones& conteo = conteoAsignaciones();
+    conteo.asignaciones.fetch_add(1, std::memory_order_relaxed);
+    conteo.bytes.fetch_add(tamano, std::memory_order_relaxed);
+    int64_t vivos = conteo.vivos.fetch_add(static_cast<int64_t>(tamano), std::memory_order_relaxed) + static_cast<int64_t>(tamano);
+    int64_t pico = conteo.pico.load(std::memory_order_relaxed);
+    while (vivos > pico && !conteo.pico.compare_exchange_weak(pico, vivos, std::memory_order_relaxed)) {
+    }
+}
+
+/**
+ * @brief Reserva con una cabecera de 'cabecera' bytes delante que guarda el tamaño pedido.
+ */
+inline void* asignarContando(std::size_t tamano, std::size_t alineacion) {
+    std::size_t cabecera = alineacion > CABECERA_ASIGNACION ? alineacion : CABECERA_ASIGNACION;
+    void* bloque = alineacion > CABECERA_ASIGNACION ? std::aligned_alloc(alineacion, (cabecera + tamano + alineacion - 1) / alineacion * alineacion)
+                                                    : std::malloc(cabecera + tamano);
+    if (!bloque) {
+        return nullptr;
+    }
+    char* datos = static_cast<char*>(bloque) + cabecera;
+    std::memcpy(datos - sizeof(std::size_t), &tamano, sizeof(std::size_t));
+    registrarAsignacion(tamano);
+    return datos;
+}
+
+inline void liberarContando(void* puntero, std::size_t alineacion) {
+    if (!puntero) {
+        return;
+    }
+    std::size_t cabecera = alineacion > CABECERA_ASIGNACION ? alineacion : CABECERA_ASIGNACION;
+    char* datos = static_cast<char*>(puntero);
+    std::size_t tamano;
+    std::memcpy(&tamano, datos - sizeof(std::size_t), sizeof(std::size_t));
+    conteoAsignaciones().vivos.fetch_sub(static_cast<int64_t>(tamano), std::memory_order_relaxed);
+    std::free(datos - cabecera);
+}
+
+inline void* asignarOLanzar(std::size_t tamano, std::size_t alineacion) {
+    void* puntero = asignarContando(tamano, alineacion);
+    if (!puntero) {
+        throw std::bad_alloc();
+    }
+    return puntero;
+}
+
+// Reemplazos globales: no pueden ser inline y deben definirse una sola vez por programa
+void* operator new(std::size_t tamano) { return asignarOLanzar(tamano, 0); }
+void* operator new[](std::size_t tamano) { return asignarOLanzar(tamano, 0); }
+void* operator new(std::size_t tamano, const std::nothrow_t&) noexcept { return asignarContando(tamano, 0); }
+void* operator new[](std::size_t tamano, const std::nothrow_t&) noexcept { return asignarContando(tamano, 0); }
+void* operator new(std::size_t tamano, std::align_val_t alineacion) { return asignarOLanzar(tamano, static_cast<std::size_t>(alineacion)); }
+void* operator new[](std::size_t tamano, std::align_val_t alineacion) { return asignarOLanzar(tamano, static_cast<std::size_t>(alineacion)); }
+void operator delete(void* puntero) noexcept { liberarContando(puntero, 0); }
+void operator delete[](void* puntero) noexcept { liberarContando(puntero, 0); }
+void operator delete(void* puntero, std::size_t) noexcept { liberarContando(puntero, 0); }
+void operator delete[](void* puntero, std::size_t) noexcept { liberarContando(puntero, 0); }
+void operator delete(void* puntero, const std::nothrow_t&) noexcept { liberarContando(puntero, 0); }
+void operator delete[](void* puntero, const std::nothrow_t&) noexcept { liberarContando(puntero, 0); }
+void operator delete(void* puntero, std::align_val_t alineacion) noexcept { liberarContando(puntero, static_cast<std::size_t>(alineacion)); }
+void operator delete[](void* puntero, std::align_val_t alineacion) noexcept { liberarContando(puntero, static_cast<std::size_t>(alineacion)); }
+void operator delete(void* puntero, std::size_t, std::align_val_t alineacion) noexcept { liberarContando(puntero, static_cast<std::size_t>(alineacion)); }
+void operator delete[](void* puntero, std::size_t, std::align_val_t alineacion) noexcept { liberarContando(puntero, static_cast<std::size_t>(alineacion)); }
+#else
+const bool CONTEO_ASIGNACIONES = false;
+#endif
+
+/**
+ * @brief Mide la memoria de una región: asignaciones (con MEDIR_MEMORIA) y pico de RSS.
+ *
+ * El pico de RSS de la región se obtiene reiniciando el máximo del proceso al empezar
+ * (escribiendo "5" en /proc/self/clear_refs, Linux 4.0 o posterior) y leyendo VmHWM al
+ * terminar. Si el reinicio no está permitido, el pico de RSS queda como no disponible,
+ * porque el máximo acumulado del proceso no describiría la región.
+ */
+class MedidorMemoria {
+public:
+    MedidorMemoria() {
+        if (!CONTEO_ASIGNACIONES) {
+            error = "asignaciones sin contar: compile con -DMEDIR_MEMORIA";
+        }
+        if (!reiniciarPicoRss()) {
+            error += std::string(error.empty() ? "" : "; ") + "pico de RSS no disponible: no se puede reiniciar VmHWM";
+            rssDisponible = false;
+        }
+    }
+
+    /**
+     * @brief Magnitudes que no se pueden medir y por qué (vacío si se miden todas).
+     */
+    const std::string& motivo() const {
+        return error;
+    }
+
+    void iniciar() {
+        ConteoAsignaciones& conteo = conteoAsignaciones();
+        asignacionesIniciales = conteo.asignaciones.load(std::memory_order_relaxed);
+        bytesIniciales = conteo.bytes.load(std::memory_order_relaxed);
+        vivosIniciales = conteo.vivos.load(std::memory_order_relaxed);
+        conteo.pico.store(vivosIniciales, std::memory_order_relaxed);
+        if (rssDisponible) {
+            reiniciarPicoRss();
+        }
+    }
+
+    LecturaMemoria detener() {
+        // Primero los contadores: leer /proc no debe contar como parte de la región
+        ConteoAsignaciones& conteo = conteoAsignaciones();
+        LecturaMemoria lectura = memoriaNoDisponible();
+        if (CONTEO_ASIGNACIONES) {
+            lectura[ASIGNACIONES] = static_cast<double>(conteo.asignaciones.load(std::memory_order_relaxed) - asignacionesIniciales);
+            lectura[BYTES_PEDIDOS] = static_cast<double>(conteo.bytes.load(std::memory_order_relaxed) - bytesIniciales);
+            lectura[PICO_VIVO] = static_cast<double>(conteo.pico.load(std::memory_order_relaxed) - vivosIniciales);
+        }
+        if (rssDisponible) {
+            lectura[PICO_RSS] = picoRss();
+        }
+        return lectura;
+    }
+
+private:
+    std::string error;
+    bool rssDisponible = true;
+    uint64_t asignacionesIniciales = 0;
+    uint64_t bytesIniciales = 0;
+    int64_t vivosIniciales = 0;
+
+    static bool reiniciarPicoRss() {
+#ifdef __linux__
+        int fd = open("/proc/self/clear_refs", O_WRONLY);
+        if (fd < 0) {
+            return false;
+        }
+        bool escrito = write(fd, "5", 1) == 1;
+        close(fd);
+        return escrito;
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * @brief VmHWM de /proc/self/status en bytes (-1 si no se puede leer).
+     */
+    static double picoRss() {
+        std::FILE* estado = std::fopen("/proc/self/status", "r");
+        if (!estado) {
+            return -1;
+        }
+        char linea[256];
+        double kilobytes = -1;
+        while (std::fgets(linea, sizeof(linea), estado)) {
+            if (std::strncmp(linea, "VmHWM:", 6) == 0) {
+                kilobytes = std::atof(linea + 6);
+                break;
+            }
+        }
+        std::fclose(estado);
+        return kilobytes < 0 ? -1 : kilobytes * 1024;
+    }
+};
+
+#endif
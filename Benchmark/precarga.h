@@ -0,0 +1,83 @@
+#ifndef PRECARGA_H
+#define PRECARGA_H
+
+#include <vector>
+#include <future>
+#include <chrono>
+#include <thread>
+#include <utility>
+#include <cstddef>
+
+// Carga de los grupos de pruebas en tubería: mientras se mide un grupo, otro hilo lee e
+// interpreta la entrada del siguiente. Las entradas pasan por la caché de datasets, así
+// que un archivo que usan varios grupos se lee una sola vez.
+
+/**
+ * @brief Entrega las pruebas de cada grupo en orden, cargando el siguiente por adelantado.
+ *
+ * Grupo es GrupoPruebas (basta con que tenga 'cargar'). Con 'precargar' en false cada
+ * grupo se carga al pedirlo, en el mismo hilo.
+ */
+template <class Grupo>
+class CargadorGrupos {
+public:
+    using Pruebas = decltype(std::declval<const Grupo&>().cargar());
+
+    CargadorGrupos(const std::vector<Grupo>& grupos, bool precargar) : grupos(grupos), precargar(precargar) {
+        lanzar();
+    }
+
+    ~CargadorGrupos() {
+        // Una carga pendiente se espera aquí para que no sobreviva a los grupos
+        if (proximo.valid()) {
+            proximo.wait();
+        }
+    }
+
+    bool quedan() const {
+        return siguienteGrupo < grupos.size();
+    }
+
+    /**
+     * @brief Pruebas del siguiente grupo; lanza la carga del que viene después antes de devolverlas.
+     */
+    Pruebas siguiente() {
+        auto inicio = std::chrono::steady_clock::now();
+        Pruebas pruebas = proximo.valid() ? proximo.get() : grupos[siguienteGrupo].cargar();
+        espera += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - inicio).count();
+        siguienteGrupo++;
+        lanzar();
+        return pruebas;
+    }
+
+    /**
+     * @brief Milisegundos que el hilo que mide pasó esperando entradas.
+     */
+    double esperaMs() const {
+        return espera;
+    }
+
+private:
+    const std::vector<Grupo>& grupos;
+    bool precargar;
+    std::size_t siguienteGrupo = 0;
+    std::future<Pruebas> proximo;
+    double espera = 0;
+
+    void lanzar() {
+        if (precargar && quedan()) {
+            proximo = std::async(std::launch::async, grupos[siguienteGrupo].cargar);
+        }
+    }
+};
+
+/**
+ * @brief Precarga por defecto: sólo si hay más de un hilo de hardware.
+ *
+ * Con un solo núcleo la carga en segundo plano competiría con la región medida.
+ */
+inline bool precargaPorDefecto() {
+    return std::thread::hardware_concurrency() > 1;
+}
+
+#endif
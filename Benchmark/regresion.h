@@ -0,0 +1,749 @@
+#ifndef REGRESION_H
+#define REGRESION_H
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <utility>
+#include <algorithm>
+#include <thread>
+#include <filesystem>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+// Líneas base de rendimiento por máquina y comparación de una ejecución contra ellas.
+// Cada máquina (modelo de CPU, núcleos, compilador y opciones de compilación) tiene su
+// propio archivo JSON; al comparar, cada par algoritmo x dataset se somete a la prueba
+// U de Mann-Whitney sobre las repeticiones, que no supone normalidad en los tiempos, y
+// los resultados de todos los pares se corrigen juntos por comparaciones múltiples.
+
+/**
+ * @brief Parámetros de las líneas base, leídos desde la línea de comandos.
+ */
+struct OpcionesRegresion {
+    bool guardar = false;                   // Guardar (o actualizar) la línea base de esta máquina
+    bool comparar = false;                  // Comparar la ejecución con la línea base de esta máquina
+    std::string directorio = "lineas_base";  // Directorio de los archivos de líneas base
+    double umbral = 5;                      // Aumento mínimo de la mediana, en %, para contar como regresión
+    double alfa = 0.05;                     // Nivel de significación de toda la comparación (Holm-Bonferroni)
+    double minimoMs = 0.05;                 // Mediana base mínima, en ms, para comparar un par
+};
+
+/**
+ * @brief Muestras de un par algoritmo x dataset, tal como se guardan en la línea base.
+ */
+struct MedicionBase {
+    std::string algoritmo;
+    std::string dataset;
+    std::string unidad;
+    std::vector<double> muestras;  // Milisegundos por repetición
+};
+
+/**
+ * @brief Identifica la máquina y la compilación para las que una línea base es válida.
+ */
+struct HuellaMaquina {
+    std::string cpu;
+    int nucleos = 0;
+    std::string compilador;
+    std::string opciones;
+};
+
+/**
+ * @brief Nombre del modelo de CPU según /proc/cpuinfo, o "desconocida".
+ */
+inline std::string modeloCpu() {
+    std::ifstream cpuinfo("/proc/cpuinfo");
+    std::string linea;
+    while (std::getline(cpuinfo, linea)) {
+        if (linea.compare(0, 10, "model name") == 0 || linea.compare(0, 9, "Processor") == 0) {
+            size_t separador = linea.find(':');
+            if (separador != std::string::npos) {
+                size_t inicio = linea.find_first_not_of(" \t", separador + 1);
+                return inicio == std::string::npos ? "desconocida" : linea.substr(inicio);
+            }
+        }
+    }
+    return "desconocida";
+}
+
+/**
+ * @brief Opciones de compilación que afectan al rendimiento.
+ *
+ * Se pueden fijar explícitamente con -DOPCIONES_COMPILACION="\"-O3 -march=native\"";
+ * si no, se deducen de las macros que define el compilador.
+ */
+inline std::string opcionesCompilacion() {
+#ifdef OPCIONES_COMPILACION
+    return OPCIONES_COMPILACION;
+#else
+    std::string opciones;
+#ifdef __OPTIMIZE__
+    opciones += "optimizado";
+#else
+    opciones += "sin optimizar";
+#endif
+#ifdef __OPTIMIZE_SIZE__
+    opciones += " tamaño";
+#endif
+#ifdef NDEBUG
+    opciones += " NDEBUG";
+#endif
+#ifdef __SSE4_2__
+    opciones += " sse4.2";
+#endif
+#ifdef __AVX__
+    opciones += " avx";
+#endif
+#ifdef __AVX2__
+    opciones += " avx2";
+#endif
+#ifdef __FMA__
+    opciones += " fma";
+#endif
+#ifdef __AVX512F__
+    opciones += " avx512f";
+#endif
+#if defined(__AVX512VNNI__) || defined(__AVXVNNI__)
+    opciones += " vnni";
+#endif
+#ifdef __ARM_NEON
+    opciones += " neon";
+#endif
+    return opciones;
+#endif
+}
+
+/**
+ * @brief Huella de la máquina y la compilación actuales.
+ */
+inline HuellaMaquina huellaMaquina() {
+    HuellaMaquina huella;
+    huella.cpu = modeloCpu();
+    huella.nucleos = static_cast<int>(std::thread::hardware_concurrency());
+#if defined(__clang__)
+    huella.compilador = "clang " __clang_version__;
+#elif defined(__GNUC__)
+    huella.compilador = "gcc " __VERSION__;
+#elif defined(_MSC_VER)
+    huella.compilador = "msvc " + std::to_string(_MSC_VER);
+#else
+    huella.compilador = "desconocido";
+#endif
+    huella.opciones = opcionesCompilacion();
+    return huella;
+}
+
+inline bool operator==(const HuellaMaquina& a, const HuellaMaquina& b) {
+    return a.cpu == b.cpu && a.nucleos == b.nucleos && a.compilador == b.compilador && a.opciones == b.opciones;
+}
+
+/**
+ * @brief Ruta del archivo de línea base de una huella: un hash FNV-1a de 64 bits de sus campos.
+ */
+inline std::string archivoLineaBase(const std::string& directorio, const HuellaMaquina& huella) {
+    std::string clave = huella.cpu + '\n' + std::to_string(huella.nucleos) + '\n' + huella.compilador + '\n' + huella.opciones;
+    uint64_t hash = 14695981039346656037ULL;
+    for (unsigned char c : clave) {
+        hash = (hash ^ c) * 1099511628211ULL;
+    }
+    char nombre[32];
+    std::snprintf(nombre, sizeof(nombre), "base_%016llx.json", static_cast<unsigned long long>(hash));
+    return directorio.empty() ? nombre : directorio + "/" + nombre;
+}
+
+/**
+ * @brief Valor JSON genérico, suficiente para leer los archivos de líneas base.
+ */
+struct ValorJson {
+    enum Tipo { NULO, BOOLEANO, NUMERO, CADENA, ARREGLO, OBJETO };
+    Tipo tipo = NULO;
+    bool booleano = false;
+    double numero = 0;
+    std::string cadena;
+    std::vector<ValorJson> elementos;
+    std::vector<std::pair<std::string, ValorJson>> miembros;
+
+    /**
+     * @brief Miembro de un objeto por nombre, o nullptr si no existe.
+     */
+    const ValorJson* miembro(const std::string& nombre) const {
+        for (const auto& par : miembros) {
+            if (par.first == nombre) {
+                return &par.second;
+            }
+        }
+        return nullptr;
+    }
+};
+
+/**
+ * @brief Lector JSON recursivo (RFC 8259, sin sustitutos UTF-16 en los escapes \\u).
+ */
+class LectorJson {
+public:
+    explicit LectorJson(const std::string& texto) : texto(texto) {}
+
+    /**
+     * @brief Lee el documento completo.
+     *
+     * @return bool false si el texto no es JSON válido.
+     */
+    bool leer(ValorJson& valor) {
+        posicion = 0;
+        if (!leerValor(valor)) {
+            return false;
+        }
+        saltarEspacios();
+        return posicion == texto.size();
+    }
+
+private:
+    const std::string& texto;
+    size_t posicion = 0;
+
+    void saltarEspacios() {
+        while (posicion < texto.size() && (texto[posicion] == ' ' || texto[posicion] == '\t' || texto[posicion] == '\n' || texto[posicion] == '\r')) {
+            posicion++;
+        }
+    }
+
+    bool consumir(const char* literal) {
+        size_t longitud = std::char_traits<char>::length(literal);
+        if (texto.compare(posicion, longitud, literal) != 0) {
+            return false;
+        }
+        posicion += longitud;
+        return true;
+    }
+
+    bool leerCadena(std::string& cadena) {
+        if (posicion >= texto.size() || texto[posicion] != '"') {
+            return false;
+        }
+        posicion++;
+        cadena.clear();
+        while (posicion < texto.size() && texto[posicion] != '"') {
+            char c = texto[posicion++];
+            if (c != '\\') {
+                cadena += c;
+                continue;
+            }
+            if (posicion >= texto.size()) {
+                return false;
+            }
+            char escape = texto[posicion++];
+            switch (escape) {
+                case '"': case '\\': case '/': cadena += escape; break;
+                case 'b': cadena += '\b'; break;
+                case 'f': cadena += '\f'; break;
+                case 'n': cadena += '\n'; break;
+                case 'r': cadena += '\r'; break;
+                case 't': cadena += '\t'; break;
+                case 'u': {
+                    if (posicion + 4 > texto.size()) {
+                        return false;
+                    }
+                    unsigned codigo = static_cast<unsigned>(std::strtoul(texto.substr(posicion, 4).c_str(), nullptr, 16));
+                    posicion += 4;
+                    // Codificar el punto de código en UTF-8
+                    if (codigo < 0x80) {
+                        cadena += static_cast<char>(codigo);
+                    } else if (codigo < 0x800) {
+                        cadena += static_cast<char>(0xC0 | (codigo >> 6));
+                        cadena += static_cast<char>(0x80 | (codigo & 0x3F));
+                    } else {
+                        cadena += static_cast<char>(0xE0 | (codigo >> 12));
+                        cadena += static_cast<char>(0x80 | ((codigo >> 6) & 0x3F));
+                        cadena += static_cast<char>(0x80 | (codigo & 0x3F));
+                    }
+                    break;
+                }
+                default: return false;
+            }
+        }
+        if (posicion >= texto.size()) {
+            return false;
+        }
+        posicion++;
+        return true;
+    }
+
+    bool leerValor(ValorJson& valor) {
+        saltarEspacios();
+        if (posicion >= texto.size()) {
+            return false;
+        }
+        char c = texto[posicion];
+
+        if (c == '{') {
+            valor.tipo = ValorJson::OBJETO;
+            posicion++;
+            saltarEspacios();
+            if (posicion < texto.size() && texto[posicion] == '}') {
+                posicion++;
+                return true;
+            }
+            while (true) {
+                std::pair<std::string, ValorJson> miembro;
+                saltarEspacios();
+                if (!leerCadena(miembro.first)) {
+                    return false;
+                }
+                saltarEspacios();
+                if (!consumir(":") || !leerValor(miembro.second)) {
+                    return false;
+                }
+                valor.miembros.push_back(std::move(miembro));
+                saltarEspacios();
+                if (consumir("}")) {
+                    return true;
+                }
+                if (!consumir(",")) {
+                    return false;
+                }
+            }
+        }
+        if (c == '[') {
+            valor.tipo = ValorJson::ARREGLO;
+            posicion++;
+            saltarEspacios();
+            if (posicion < texto.size() && texto[posicion] == ']') {
+                posicion++;
+                return true;
+            }
+            while (true) {
+                valor.elementos.emplace_back();
+                if (!leerValor(valor.elementos.back())) {
+                    return false;
+                }
+                saltarEspacios();
+                if (consumir("]")) {
+                    return true;
+                }
+                if (!consumir(",")) {
+                    return false;
+                }
+            }
+        }
+        if (c == '"') {
+            valor.tipo = ValorJson::CADENA;
+            return leerCadena(valor.cadena);
+        }
+        if (consumir("true")) {
+            valor.tipo = ValorJson::BOOLEANO;
+            valor.booleano = true;
+            return true;
+        }
+        if (consumir("false")) {
+            valor.tipo = ValorJson::BOOLEANO;
+            return true;
+        }
+        if (consumir("null")) {
+            valor.tipo = ValorJson::NULO;
+            return true;
+        }
+
+        const char* inicio = texto.c_str() + posicion;
+        char* fin = nullptr;
+        valor.numero = std::strtod(inicio, &fin);
+        if (fin == inicio) {
+            return false;
+        }
+        valor.tipo = ValorJson::NUMERO;
+        posicion += fin - inicio;
+        return true;
+    }
+};
+
+/**
+ * @brief Escapa una cadena para JSON (entre comillas dobles).
+ */
+inline std::string escaparJson(const std::string& texto) {
+    std::string resultado = "\"";
+    for (char c : texto) {
+        if (c == '"' || c == '\\') {
+            resultado += '\\';
+            resultado += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            char codigo[8];
+            std::snprintf(codigo, sizeof(codigo), "\\u%04x", c);
+            resultado += codigo;
+        } else {
+            resultado += c;
+        }
+    }
+    return resultado + "\"";
+}
+
+/**
+ * @brief Lee una línea base.
+ *
+ * @param archivo Ruta del archivo.
+ * @param huella Huella guardada en el archivo.
+ * @param mediciones Mediciones guardadas.
+ * @return bool false si el archivo no existe o no tiene el formato esperado.
+ */
+inline bool leerLineaBase(const std::string& archivo, HuellaMaquina& huella, std::vector<MedicionBase>& mediciones) {
+    std::ifstream entrada(archivo);
+    if (!entrada) {
+        return false;
+    }
+    std::stringstream contenido;
+    contenido << entrada.rdbuf();
+    std::string texto = contenido.str();
+
+    ValorJson documento;
+    if (!LectorJson(texto).leer(documento) || documento.tipo != ValorJson::OBJETO) {
+        return false;
+    }
+    const ValorJson* datosHuella = documento.miembro("huella");
+    const ValorJson* resultados = documento.miembro("resultados");
+    if (!datosHuella || !resultados || resultados->tipo != ValorJson::ARREGLO) {
+        return false;
+    }
+
+    auto cadena = [](const ValorJson& objeto, const char* nombre) {
+        const ValorJson* valor = objeto.miembro(nombre);
+        return valor && valor->tipo == ValorJson::CADENA ? valor->cadena : std::string();
+    };
+    huella.cpu = cadena(*datosHuella, "cpu");
+    huella.compilador = cadena(*datosHuella, "compilador");
+    huella.opciones = cadena(*datosHuella, "opciones");
+    const ValorJson* nucleos = datosHuella->miembro("nucleos");
+    huella.nucleos = nucleos && nucleos->tipo == ValorJson::NUMERO ? static_cast<int>(nucleos->numero) : 0;
+
+    mediciones.clear();
+    for (const ValorJson& resultado : resultados->elementos) {
+        MedicionBase medicion;
+        medicion.algoritmo = cadena(resultado, "algoritmo");
+        medicion.dataset = cadena(resultado, "dataset");
+        medicion.unidad = cadena(resultado, "unidad");
+        const ValorJson* muestras = resultado.miembro("muestras_ms");
+        if (!muestras || muestras->tipo != ValorJson::ARREGLO) {
+            return false;
+        }
+        for (const ValorJson& muestra : muestras->elementos) {
+            if (muestra.tipo == ValorJson::NUMERO) {
+                medicion.muestras.push_back(muestra.numero);
+            }
+        }
+        mediciones.push_back(std::move(medicion));
+    }
+    return true;
+}
+
+/**
+ * @brief Escribe una línea base completa (huella y mediciones).
+ *
+ * @return bool false si no se pudo escribir el archivo.
+ */
+inline bool escribirLineaBase(const std::string& archivo, const HuellaMaquina& huella, const std::vector<MedicionBase>& mediciones) {
+    std::ofstream salida(archivo);
+    if (!salida) {
+        return false;
+    }
+    salida << std::setprecision(10);
+    salida << "{\n  \"huella\": {\"cpu\": " << escaparJson(huella.cpu) << ", \"nucleos\": " << huella.nucleos
+           << ", \"compilador\": " << escaparJson(huella.compilador) << ", \"opciones\": " << escaparJson(huella.opciones) << "},\n"
+           << "  \"resultados\": [\n";
+    for (size_t i = 0; i < mediciones.size(); i++) {
+        const MedicionBase& m = mediciones[i];
+        salida << "    {\"algoritmo\": " << escaparJson(m.algoritmo) << ", \"dataset\": " << escaparJson(m.dataset)
+               << ", \"unidad\": " << escaparJson(m.unidad) << ", \"muestras_ms\": [";
+        for (size_t j = 0; j < m.muestras.size(); j++) {
+            salida << (j > 0 ? ", " : "") << m.muestras[j];
+        }
+        salida << "]}" << (i + 1 < mediciones.size() ? "," : "") << "\n";
+    }
+    salida << "  ]\n}\n";
+    return static_cast<bool>(salida);
+}
+
+/**
+ * @brief Resultado de la prueba U de Mann-Whitney entre la línea base y la ejecución actual.
+ */
+struct PruebaMannWhitney {
+    double u = 0;             // Pares (base, actual) en que la actual es más lenta; los empates cuentan 1/2
+    double pMasLento = 1;     // p unilateral de que la ejecución actual sea más lenta
+    double pMasRapido = 1;    // p unilateral de que la ejecución actual sea más rápida
+    double pMinimo = 1;       // El menor p alcanzable con estos tamaños de muestra
+    bool exacta = false;      // Distribución exacta (sin empates y muestras pequeñas) o aproximación normal
+};
+
+/**
+ * @brief Prueba U de Mann-Whitney entre dos muestras independientes.
+ *
+ * Sin empates y con hasta 50 muestras en total se usa la distribución exacta de U
+ * (número de ordenaciones con cada valor, por programación dinámica). En otro caso,
+ * la aproximación normal con corrección por empates y por continuidad.
+ */
+inline PruebaMannWhitney mannWhitney(const std::vector<double>& base, const std::vector<double>& actual) {
+    PruebaMannWhitney prueba;
+    size_t n1 = base.size(), n2 = actual.size();
+    if (n1 == 0 || n2 == 0) {
+        return prueba;
+    }
+
+    bool empates = false;
+    for (double b : base) {
+        for (double a : actual) {
+            prueba.u += a > b ? 1.0 : a == b ? 0.5 : 0.0;
+            empates = empates || a == b;
+        }
+    }
+    std::vector<double> todas(base);
+    todas.insert(todas.end(), actual.begin(), actual.end());
+    std::sort(todas.begin(), todas.end());
+    empates = empates || std::adjacent_find(todas.begin(), todas.end()) != todas.end();
+
+    double total = static_cast<double>(n1) * n2;
+    if (!empates && n1 + n2 <= 50) {
+        // cuentas[j][u]: ordenaciones de i muestras de la base y j actuales con estadístico u
+        std::vector<std::vector<double>> anterior(n2 + 1), cuentas(n2 + 1);
+        for (size_t j = 0; j <= n2; j++) {
+            anterior[j].assign(1, 1.0);  // Con cero muestras de la base, U = 0 de una sola forma
+        }
+        for (size_t i = 1; i <= n1; i++) {
+            for (size_t j = 0; j <= n2; j++) {
+                cuentas[j].assign(i * j + 1, 0.0);
+                // La mayor muestra es de la base (no suma) o actual (suma las i de la base)
+                for (size_t u = 0; u < anterior[j].size(); u++) {
+                    cuentas[j][u] += anterior[j][u];
+                }
+                if (j > 0) {
+                    for (size_t u = 0; u < cuentas[j - 1].size(); u++) {
+                        cuentas[j][u + i] += cuentas[j - 1][u];
+                    }
+                }
+            }
+            std::swap(anterior, cuentas);
+        }
+        const std::vector<double>& distribucion = anterior[n2];
+        double ordenaciones = 0;
+        for (double c : distribucion) {
+            ordenaciones += c;
+        }
+        size_t observado = static_cast<size_t>(prueba.u);
+        double mayorIgual = 0, menorIgual = 0;
+        for (size_t u = 0; u < distribucion.size(); u++) {
+            if (u >= observado) {
+                mayorIgual += distribucion[u];
+            }
+            if (u <= observado) {
+                menorIgual += distribucion[u];
+            }
+        }
+        prueba.pMasLento = mayorIgual / ordenaciones;
+        prueba.pMasRapido = menorIgual / ordenaciones;
+        prueba.pMinimo = 1.0 / ordenaciones;
+        prueba.exacta = true;
+        return prueba;
+    }
+
+    // Aproximación normal; la varianza se corrige con los grupos de valores empatados
+    double n = static_cast<double>(n1 + n2);
+    double correccion = 0;
+    for (size_t i = 0; i < todas.size();) {
+        size_t j = i;
+        while (j < todas.size() && todas[j] == todas[i]) {
+            j++;
+        }
+        double t = static_cast<double>(j - i);
+        correccion += t * t * t - t;
+        i = j;
+    }
+    double media = total / 2;
+    double varianza = total / 12 * ((n + 1) - correccion / (n * (n - 1)));
+    if (varianza <= 0) {
+        return prueba;
+    }
+    double desviacion = std::sqrt(varianza);
+    auto colaSuperior = [](double z) { return 0.5 * std::erfc(z / std::sqrt(2.0)); };
+    prueba.pMasLento = colaSuperior((prueba.u - media - 0.5) / desviacion);
+    prueba.pMasRapido = colaSuperior((media - prueba.u - 0.5) / desviacion);
+    prueba.pMinimo = colaSuperior((total - media - 0.5) / desviacion);
+    return prueba;
+}
+
+/**
+ * @brief Mediana de un conjunto de muestras (0 si está vacío).
+ */
+inline double medianaMuestras(std::vector<double> muestras) {
+    if (muestras.empty()) {
+        return 0;
+    }
+    std::sort(muestras.begin(), muestras.end());
+    size_t n = muestras.size();
+    return n % 2 == 1 ? muestras[n / 2] : (muestras[n / 2 - 1] + muestras[n / 2]) / 2;
+}
+
+/**
+ * @brief Guarda las mediciones en la línea base de esta máquina.
+ *
+ * Si ya existe, se conservan los pares que no se midieron ahora (por ejemplo, al usar
+ * --filtro) y se reemplazan los demás.
+ *
+ * @return bool false si no se pudo escribir el archivo.
+ */
+inline bool guardarLineaBase(const std::vector<MedicionBase>& mediciones, const OpcionesRegresion& opciones, std::ostream& informe) {
+    HuellaMaquina huella = huellaMaquina();
+    std::string archivo = archivoLineaBase(opciones.directorio, huella);
+
+    HuellaMaquina huellaGuardada;
+    std::vector<MedicionBase> combinadas;
+    if (leerLineaBase(archivo, huellaGuardada, combinadas) && !(huellaGuardada == huella)) {
+        combinadas.clear();
+    }
+    for (const MedicionBase& medicion : mediciones) {
+        auto existente = std::find_if(combinadas.begin(), combinadas.end(), [&](const MedicionBase& m) {
+            return m.algoritmo == medicion.algoritmo && m.dataset == medicion.dataset;
+        });
+        if (existente != combinadas.end()) {
+            *existente = medicion;
+        } else {
+            combinadas.push_back(medicion);
+        }
+    }
+
+    std::error_code error;
+    if (!opciones.directorio.empty()) {
+        std::filesystem::create_directories(opciones.directorio, error);
+    }
+    if (!escribirLineaBase(archivo, huella, combinadas)) {
+        std::cerr << "Error: no se pudo escribir la línea base " << archivo << "." << std::endl;
+        return false;
+    }
+    informe << "Línea base guardada en " << archivo << " (" << mediciones.size() << " de " << combinadas.size() << " pares actualizados)." << std::endl;
+    return true;
+}
+
+/**
+ * @brief Corrección de Holm-Bonferroni: valores p ajustados para m pruebas simultáneas.
+ *
+ * Con los p ordenados de menor a mayor, el k-ésimo (desde 0) se multiplica por m - k y
+ * se fuerza a no bajar respecto del anterior. Rechazar donde el ajustado es menor que
+ * alfa mantiene en alfa la probabilidad de algún falso positivo en toda la familia.
+ */
+inline std::vector<double> ajusteHolm(const std::vector<double>& p) {
+    size_t m = p.size();
+    std::vector<size_t> orden(m);
+    for (size_t k = 0; k < m; k++) {
+        orden[k] = k;
+    }
+    std::sort(orden.begin(), orden.end(), [&](size_t a, size_t b) { return p[a] < p[b]; });
+    std::vector<double> ajustados(m);
+    double maximo = 0;
+    for (size_t k = 0; k < m; k++) {
+        maximo = std::max(maximo, std::min(1.0, p[orden[k]] * static_cast<double>(m - k)));
+        ajustados[orden[k]] = maximo;
+    }
+    return ajustados;
+}
+
+/**
+ * @brief Compara las mediciones con la línea base de esta máquina y muestra un informe.
+ *
+ * Cada par se somete a Mann-Whitney en la dirección de su cambio de mediana, y los p de
+ * todos los pares se corrigen con Holm-Bonferroni: alfa es el nivel de toda la familia,
+ * no de cada par, para que comparar una ejecución consigo misma no dé regresiones al azar.
+ * Un par es una regresión si su p ajustado es menor que alfa y su mediana supera a la de
+ * la base en más del umbral (una mejora, lo simétrico). Los pares de mediana base
+ * menor que minimoMs no se comparan: en regiones tan breves el tiempo varía de una
+ * ejecución a otra más que cualquier cambio de código que se quiera detectar.
+ *
+ * @return int Número de regresiones, o -1 si no hay línea base para esta máquina.
+ */
+inline int compararConLineaBase(const std::vector<MedicionBase>& mediciones, const OpcionesRegresion& opciones, std::ostream& informe) {
+    HuellaMaquina huella = huellaMaquina();
+    std::string archivo = archivoLineaBase(opciones.directorio, huella);
+
+    HuellaMaquina huellaGuardada;
+    std::vector<MedicionBase> base;
+    if (!leerLineaBase(archivo, huellaGuardada, base)) {
+        std::cerr << "Error: no hay línea base válida para esta máquina en " << archivo << " (se crea con --guardar-base)." << std::endl;
+        return -1;
+    }
+    if (!(huellaGuardada == huella)) {
+        std::cerr << "Error: la línea base " << archivo << " pertenece a otra máquina o compilación." << std::endl;
+        return -1;
+    }
+
+    struct Par {
+        const MedicionBase* medicion;
+        double medianaBase;
+        double medianaActual;
+        double cambio;
+        double pMinimo;
+    };
+    std::vector<Par> pares;
+    std::vector<double> valoresP;
+    int sinBase = 0, breves = 0;
+    for (const MedicionBase& medicion : mediciones) {
+        auto anterior = std::find_if(base.begin(), base.end(), [&](const MedicionBase& m) {
+            return m.algoritmo == medicion.algoritmo && m.dataset == medicion.dataset;
+        });
+        if (anterior == base.end() || anterior->muestras.empty()) {
+            sinBase++;
+            continue;
+        }
+        double medianaBase = medianaMuestras(anterior->muestras);
+        if (medianaBase < opciones.minimoMs) {
+            breves++;
+            continue;
+        }
+
+        PruebaMannWhitney prueba = mannWhitney(anterior->muestras, medicion.muestras);
+        double medianaActual = medianaMuestras(medicion.muestras);
+        double cambio = medianaBase > 0 ? (medianaActual / medianaBase - 1) * 100 : 0;
+        pares.push_back({&medicion, medianaBase, medianaActual, cambio, prueba.pMinimo});
+        valoresP.push_back(cambio >= 0 ? prueba.pMasLento : prueba.pMasRapido);
+    }
+    std::vector<double> ajustados = ajusteHolm(valoresP);
+
+    int regresiones = 0, mejoras = 0;
+    bool pocasMuestras = false;
+    informe << "Comparación con " << archivo << " (umbral " << opciones.umbral << "%, alfa " << opciones.alfa
+            << " para los " << pares.size() << " pares, Holm-Bonferroni):" << std::endl;
+    for (size_t k = 0; k < pares.size(); k++) {
+        const Par& par = pares[k];
+        // Ni siendo el menor de todos podría este par bajar de alfa tras multiplicarlo por m
+        pocasMuestras = pocasMuestras || par.pMinimo * static_cast<double>(pares.size()) >= opciones.alfa;
+
+        const char* veredicto = "sin cambio significativo";
+        if (ajustados[k] < opciones.alfa && par.cambio > opciones.umbral) {
+            veredicto = "REGRESIÓN";
+            regresiones++;
+        } else if (ajustados[k] < opciones.alfa && par.cambio < -opciones.umbral) {
+            veredicto = "mejora";
+            mejoras++;
+        }
+
+        std::ostringstream linea;
+        linea << std::fixed << std::setprecision(3) << "  " << par.medicion->algoritmo << " de " << par.medicion->dataset << ": "
+              << par.medianaBase << " -> " << par.medianaActual << " ms (" << std::showpos << std::setprecision(1) << par.cambio << "%" << std::noshowpos
+              << ", p=" << std::setprecision(4) << valoresP[k] << ", ajustado " << ajustados[k] << ") " << veredicto;
+        informe << linea.str() << std::endl;
+    }
+
+    informe << regresiones << " regresiones, " << mejoras << " mejoras";
+    if (sinBase > 0) {
+        informe << ", " << sinBase << " pares sin línea base";
+    }
+    if (breves > 0) {
+        informe << ", " << breves << " pares de menos de " << opciones.minimoMs << " ms sin comparar";
+    }
+    informe << "." << std::endl;
+    if (pocasMuestras) {
+        std::cerr << "Aviso: con tan pocas repeticiones para " << pares.size() << " pares, alguna diferencia no puede ser significativa al nivel "
+                  << opciones.alfa << "; use más --repeticiones." << std::endl;
+    }
+    return regresiones;
+}
+
+#endif
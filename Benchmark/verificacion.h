@@ -0,0 +1,250 @@
+#ifndef VERIFICACION_H
+#define VERIFICACION_H
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <random>
+#include <cmath>
+
+/**
+ * @brief Huella de un multiconjunto de enteros, independiente del orden de los elementos.
+ *
+ * Suma dos funciones de mezcla distintas de cada valor (módulo 2^64): un reordenamiento
+ * conserva la huella, mientras que perder, duplicar o alterar un elemento la cambia
+ * con probabilidad abrumadora.
+ */
+struct ChecksumMulticonjunto {
+    uint64_t cantidad = 0;
+    uint64_t suma1 = 0;
+    uint64_t suma2 = 0;
+
+    bool operator==(const ChecksumMulticonjunto& otro) const {
+        return cantidad == otro.cantidad && suma1 == otro.suma1 && suma2 == otro.suma2;
+    }
+    bool operator!=(const ChecksumMulticonjunto& otro) const {
+        return !(*this == otro);
+    }
+};
+
+/**
+ * @brief Función de mezcla splitmix64.
+ */
+inline uint64_t mezclar64(uint64_t x) {
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+/**
+ * @brief Calcula la huella de multiconjunto de un vector de enteros en O(n).
+ */
+inline ChecksumMulticonjunto checksumMulticonjunto(const std::vector<int>& datos) {
+    ChecksumMulticonjunto checksum;
+    checksum.cantidad = datos.size();
+    for (int valor : datos) {
+        uint64_t x = static_cast<uint32_t>(valor);
+        checksum.suma1 += mezclar64(x);
+        checksum.suma2 += mezclar64(x ^ 0x5bd1e9955bd1e995ULL);
+    }
+    return checksum;
+}
+
+/**
+ * @brief Comprueba en O(n) que un vector está ordenado de forma no decreciente.
+ */
+inline bool estaOrdenado(const std::vector<int>& datos) {
+    for (size_t i = 1; i < datos.size(); i++) {
+        if (datos[i] < datos[i - 1]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Verifica un ordenamiento: salida ordenada y mismo multiconjunto que la entrada.
+ *
+ * @param esperado Huella del dataset original, calculada una sola vez al cargarlo.
+ * @param resultado Vector tal como lo dejó el algoritmo.
+ */
+inline bool verificarOrdenamiento(const ChecksumMulticonjunto& esperado, const std::vector<int>& resultado) {
+    return estaOrdenado(resultado) && checksumMulticonjunto(resultado) == esperado;
+}
+
+/**
+ * @brief Verifica una selección: 'nth' queda en su lugar y el resto, a su lado correcto.
+ *
+ * @param esperado Huella del dataset original.
+ * @param resultado Vector tal como lo dejó el algoritmo.
+ * @param nth Posición seleccionada.
+ */
+inline bool verificarSeleccion(const ChecksumMulticonjunto& esperado, const std::vector<int>& resultado, size_t nth) {
+    if (nth >= resultado.size() || checksumMulticonjunto(resultado) != esperado) {
+        return false;
+    }
+    for (size_t i = 0; i < resultado.size(); i++) {
+        if ((i < nth && resultado[i] > resultado[nth]) || (i > nth && resultado[i] < resultado[nth])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Verifica un top-k: el prefijo de k elementos está ordenado y no supera a ningún otro.
+ */
+inline bool verificarTopK(const ChecksumMulticonjunto& esperado, const std::vector<int>& resultado, size_t k) {
+    if (k == 0 || k > resultado.size() || checksumMulticonjunto(resultado) != esperado) {
+        return false;
+    }
+    for (size_t i = 1; i < k; i++) {
+        if (resultado[i] < resultado[i - 1]) {
+            return false;
+        }
+    }
+    for (size_t i = k; i < resultado.size(); i++) {
+        if (resultado[i] < resultado[k - 1]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Verificación probabilística de Freivalds: comprueba A·B = C en O(n²) por iteración.
+ *
+ * Compara A·(B·r) con C·r para vectores r aleatorios, con aritmética entera módulo 2^64
+ * (la igualdad exacta se conserva módulo 2^64). Si C es incorrecta, cada iteración la
+ * detecta con probabilidad de al menos 1/2, y prácticamente siempre cuando alguna
+ * diferencia de A·B - C es impar. Con 8 iteraciones el error pasa inadvertido con
+ * probabilidad menor que 2^-8 en el peor caso.
+ *
+ * @param A Primera matriz (m x k).
+ * @param B Segunda matriz (k x n).
+ * @param C Producto a verificar (debe ser m x n).
+ * @param iteraciones Número de vectores aleatorios.
+ * @return bool true si C supera todas las iteraciones.
+ */
+template <class T>
+bool freivalds(const std::vector<std::vector<T>>& A, const std::vector<std::vector<T>>& B, const std::vector<std::vector<T>>& C, int iteraciones = 8) {
+    size_t m = A.size();
+    size_t k = B.size();
+    size_t n = B.empty() ? 0 : B[0].size();
+
+    // Comprobar las dimensiones antes de nada
+    if (C.size() != m || (m > 0 && A[0].size() != k)) {
+        return false;
+    }
+    for (const auto& fila : C) {
+        if (fila.size() != n) {
+            return false;
+        }
+    }
+
+    std::random_device semilla;
+    std::mt19937_64 generador(semilla());
+    std::vector<uint64_t> r(n), Br(k);
+
+    for (int iteracion = 0; iteracion < iteraciones; iteracion++) {
+        for (uint64_t& valor : r) {
+            valor = generador();
+        }
+
+        // B·r, luego A·(B·r) y C·r
+        for (size_t i = 0; i < k; i++) {
+            uint64_t suma = 0;
+            for (size_t j = 0; j < n; j++) {
+                suma += static_cast<uint64_t>(B[i][j]) * r[j];
+            }
+            Br[i] = suma;
+        }
+        for (size_t i = 0; i < m; i++) {
+            uint64_t sumaA = 0;
+            for (size_t j = 0; j < k; j++) {
+                sumaA += static_cast<uint64_t>(A[i][j]) * Br[j];
+            }
+            uint64_t sumaC = 0;
+            for (size_t j = 0; j < n; j++) {
+                sumaC += static_cast<uint64_t>(C[i][j]) * r[j];
+            }
+            if (sumaA != sumaC) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief Verifica el producto de una cadena de matrices de punto flotante: C·x ≈ A1·(A2·(...·(An·x))).
+ *
+ * Aplicar la cadena a un vector cuesta O(suma de m·k), sin ningún producto de matrices.
+ * Con punto flotante el orden de evaluación cambia el redondeo, así que se admite un
+ * error relativo 'tolerancia' respecto de la norma del resultado.
+ *
+ * @param matrices Factores A1..An.
+ * @param C Producto a verificar.
+ * @param tolerancia Error relativo admitido.
+ * @return bool true si C supera la comprobación con dos vectores aleatorios.
+ */
+template <class T>
+bool verificarCadena(const std::vector<std::vector<std::vector<T>>>& matrices, const std::vector<std::vector<T>>& C, double tolerancia = 1e-9) {
+    if (matrices.empty()) {
+        return false;
+    }
+    size_t columnas = matrices.back().empty() ? 0 : matrices.back()[0].size();
+    if (C.size() != matrices.front().size()) {
+        return false;
+    }
+    for (const auto& fila : C) {
+        if (fila.size() != columnas) {
+            return false;
+        }
+    }
+
+    std::mt19937_64 generador(std::random_device{}());
+    std::uniform_real_distribution<double> distribucion(-1.0, 1.0);
+
+    for (int iteracion = 0; iteracion < 2; iteracion++) {
+        std::vector<double> x(columnas);
+        for (double& valor : x) {
+            valor = distribucion(generador);
+        }
+
+        // Aplicar la cadena de derecha a izquierda
+        std::vector<double> y = x;
+        for (size_t m = matrices.size(); m-- > 0;) {
+            const auto& M = matrices[m];
+            if (!M.empty() && M[0].size() != y.size()) {
+                return false;
+            }
+            std::vector<double> siguiente(M.size(), 0.0);
+            for (size_t i = 0; i < M.size(); i++) {
+                for (size_t j = 0; j < y.size(); j++) {
+                    siguiente[i] += static_cast<double>(M[i][j]) * y[j];
+                }
+            }
+            y = std::move(siguiente);
+        }
+
+        double norma = 0, error = 0;
+        for (size_t i = 0; i < C.size(); i++) {
+            double Cx = 0;
+            for (size_t j = 0; j < columnas; j++) {
+                Cx += static_cast<double>(C[i][j]) * x[j];
+            }
+            norma += y[i] * y[i];
+            error += (Cx - y[i]) * (Cx - y[i]);
+        }
+        if (!(std::sqrt(error) <= tolerancia * std::sqrt(norma) + tolerancia)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+#endif
@@ -2,6 +2,7 @@
 #include <vector>
 #include <fstream>
 #include <random>
+#include "datasets.h"
 
 using namespace std;
 
@@ -10,20 +11,28 @@ using namespace std;
  * 
  * @param filas Número de filas de la matriz.
  * @param columnas Número de columnas de la matriz.
+ * @param densidad Fracción de elementos distintos de cero (1: matriz densa). Con densidad
+ *                 menor que 1, cada elemento es no nulo con esa probabilidad y vale entre 1 y 100.
  * @return vector<vector<int>> Matriz generada aleatoriamente.
  */
-vector<vector<int>> generarMatrizAleatoria(int filas, int columnas) {
-    vector<vector<int>> matriz(filas, vector<int>(columnas));
+vector<vector<int>> generarMatrizAleatoria(int filas, int columnas, double densidad = 1.0) {
+    vector<vector<int>> matriz(filas, vector<int>(columnas, 0));
     
     // Generador de números aleatorios
     random_device rd;
     mt19937 generador(rd());
     uniform_int_distribution<> distribucion(0, 100); // Valores aleatorios entre 0 y 100
+    uniform_int_distribution<> distribucionNoNula(1, 100);
+    bernoulli_distribution noNulo(densidad);
 
     // Llenar la matriz con valores aleatorios
     for (int i = 0; i < filas; i++) {
         for (int j = 0; j < columnas; j++) {
-            matriz[i][j] = distribucion(generador);
+            if (densidad >= 1.0) {
+                matriz[i][j] = distribucion(generador);
+            } else if (noNulo(generador)) {
+                matriz[i][j] = distribucionNoNula(generador);
+            }
         }
     }
 
@@ -73,6 +82,11 @@ int main() {
     guardarMatrizEnArchivo(matriz100x500, "matriz_100x500.txt");
     guardarMatrizEnArchivo(matriz500x1000, "matriz_500x1000.txt");
 
+    // Generar matrices dispersas de 1000x1000 con distintas densidades
+    for (int densidad : densidadesDispersas()) {
+        guardarMatrizEnArchivo(generarMatrizAleatoria(1000, 1000, densidad / 100.0), archivoMatrizDispersa(1000, densidad));
+    }
+
     // Mostrar mensaje de confirmación
     cout << "Matrices generadas y guardadas." << endl;
 
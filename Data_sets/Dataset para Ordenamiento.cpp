@@ -3,6 +3,7 @@
 #include <fstream>
 #include <algorithm>
 #include <random>
+#include "comprimido.h"
 
 using namespace std;
 
@@ -59,7 +60,7 @@ vector<int> generarDatasetOrdenado(int tamano) {
 }
 
 /**
- * @brief Guarda un dataset en un archivo de texto.
+ * @brief Guarda un dataset en un archivo de texto y su versión comprimida (ver comprimido.h).
  * 
  * @param dataset Dataset que se desea guardar.
  * @param nombreArchivo Nombre del archivo donde se guardará el dataset.
@@ -73,6 +74,9 @@ void guardarDatasetEnArchivo(const vector<int>& dataset, const string& nombreArc
     }
 
     archivo.close();
+
+    // Los programas de ordenamiento leen la versión comprimida si existe
+    guardarDatasetComprimido(dataset, archivoDatasetComprimido(nombreArchivo));
 }
 
 /**
@@ -0,0 +1,158 @@
+#ifndef CACHE_DATASETS_H
+#define CACHE_DATASETS_H
+
+#include <vector>
+#include <string>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <future>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include "datasets.h"
+#include "comprimido.h"
+
+// Caché de entradas ya leídas, indexada por ruta (y forma, para las matrices). Cada
+// archivo se interpreta una sola vez aunque lo pidan varios grupos de pruebas, o A y B
+// del mismo caso, y aunque lo pidan a la vez el hilo de precarga y el principal: el
+// segundo espera a la lectura del primero. Las entradas son inmutables; quien necesite
+// modificarlas trabaja sobre una copia.
+
+const std::size_t PRESUPUESTO_CACHE_DATASETS = std::size_t(512) << 20;  // Bytes que se conservan como máximo
+
+class CacheDatasets {
+public:
+    using Dataset = std::vector<int>;
+    using Matriz = std::vector<std::vector<int>>;
+
+    explicit CacheDatasets(std::size_t presupuesto = PRESUPUESTO_CACHE_DATASETS) : presupuesto(presupuesto) {}
+
+    /**
+     * @brief Dataset de enteros del archivo, leído la primera vez (de su versión comprimida si la hay).
+     */
+    std::shared_ptr<const Dataset> dataset(const std::string& archivo) {
+        return buscarOLeer<Dataset>("dataset:" + archivo, [archivo]() {
+            auto datos = std::make_shared<const Dataset>(leerDatasetPreferiblementeComprimido(archivo));
+            return std::make_pair(datos, datos->size() * sizeof(int));
+        });
+    }
+
+    /**
+     * @brief Matriz de filas x columnas del archivo, leída con leerMatrizDesdeArchivo la primera vez.
+     */
+    std::shared_ptr<const Matriz> matriz(const std::string& archivo, int filas, int columnas) {
+        std::string clave = "matriz:" + archivo + ":" + std::to_string(filas) + "x" + std::to_string(columnas);
+        return buscarOLeer<Matriz>(clave, [archivo, filas, columnas]() {
+            auto datos = std::make_shared<const Matriz>(leerMatrizDesdeArchivo(archivo, filas, columnas));
+            return std::make_pair(datos, static_cast<std::size_t>(filas) * (columnas * sizeof(int) + sizeof(std::vector<int>)));
+        });
+    }
+
+    /**
+     * @brief Archivos leídos de disco y pedidos servidos desde la caché.
+     */
+    std::size_t lecturas() const {
+        std::lock_guard<std::mutex> bloqueo(mutex);
+        return leidos;
+    }
+
+    std::size_t aciertos() const {
+        std::lock_guard<std::mutex> bloqueo(mutex);
+        return reutilizados;
+    }
+
+private:
+    struct Entrada {
+        std::shared_future<std::shared_ptr<const void>> valor;
+        std::size_t bytes = 0;
+        std::uint64_t uso = 0;  // Marca del último pedido, para descartar la menos usada
+    };
+
+    mutable std::mutex mutex;
+    std::map<std::string, Entrada> entradas;
+    std::size_t presupuesto;
+    std::size_t ocupados = 0;
+    std::uint64_t reloj = 0;
+    std::size_t leidos = 0;
+    std::size_t reutilizados = 0;
+
+    template <class T, class Leer>
+    std::shared_ptr<const T> buscarOLeer(const std::string& clave, Leer leer) {
+        std::promise<std::shared_ptr<const void>> promesa;
+        std::shared_future<std::shared_ptr<const void>> valor;
+        {
+            std::lock_guard<std::mutex> bloqueo(mutex);
+            auto encontrada = entradas.find(clave);
+            if (encontrada != entradas.end()) {
+                encontrada->second.uso = ++reloj;
+                reutilizados++;
+                valor = encontrada->second.valor;
+            } else {
+                Entrada& entrada = entradas[clave];
+                entrada.valor = promesa.get_future().share();
+                entrada.uso = ++reloj;
+                leidos++;
+            }
+        }
+        if (valor.valid()) {
+            return std::static_pointer_cast<const T>(valor.get());
+        }
+
+        // La lectura se hace sin el cerrojo: otras claves se siguen sirviendo mientras tanto
+        std::shared_ptr<const T> datos;
+        std::size_t bytes = 0;
+        try {
+            auto leido = leer();
+            datos = leido.first;
+            bytes = leido.second;
+        } catch (...) {
+            promesa.set_exception(std::current_exception());
+            std::lock_guard<std::mutex> bloqueo(mutex);
+            entradas.erase(clave);
+            throw;
+        }
+        promesa.set_value(datos);
+
+        std::lock_guard<std::mutex> bloqueo(mutex);
+        auto entrada = entradas.find(clave);
+        if (entrada != entradas.end()) {
+            entrada->second.bytes = bytes;
+            ocupados += bytes;
+        }
+        descartarMenosUsadas(clave);
+        return datos;
+    }
+
+    /**
+     * @brief Descarta las entradas ya leídas menos usadas hasta volver al presupuesto (nunca 'actual').
+     *
+     * Quien ya tiene una entrada descartada la conserva mientras mantenga su shared_ptr.
+     */
+    void descartarMenosUsadas(const std::string& actual) {
+        while (ocupados > presupuesto) {
+            auto victima = entradas.end();
+            for (auto it = entradas.begin(); it != entradas.end(); ++it) {
+                bool lista = it->second.valor.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+                if (it->first != actual && lista && (victima == entradas.end() || it->second.uso < victima->second.uso)) {
+                    victima = it;
+                }
+            }
+            if (victima == entradas.end()) {
+                return;
+            }
+            ocupados -= victima->second.bytes;
+            entradas.erase(victima);
+        }
+    }
+};
+
+/**
+ * @brief Caché compartida por todos los grupos de pruebas del programa.
+ */
+inline CacheDatasets& cacheDatasets() {
+    static CacheDatasets cache;
+    return cache;
+}
+
+#endif
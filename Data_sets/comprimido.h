@@ -0,0 +1,459 @@
+#ifndef COMPRIMIDO_H
+#define COMPRIMIDO_H
+
+#include <vector>
+#include <string>
+#include <fstream>
+#include <filesystem>
+#include <algorithm>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include "datasets.h"
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+// Almacenamiento comprimido de arreglos de enteros ordenados o parcialmente ordenados.
+// Los datos se dividen en bloques de 128 enteros y cada bloque se guarda con el modo que
+// necesite menos bits por entero:
+//   - Marco de referencia: x - mínimo del bloque (cualquier bloque).
+//   - Delta de paso 4: x[i] - x[i - 4], con x[-4..-1] = primer valor (bloques en los que
+//     cada valor es mayor o igual que el que está cuatro posiciones antes, p. ej. ordenados).
+// Los valores del bloque se empaquetan con 'bits' bits cada uno en 4 carriles intercalados
+// (el valor i va al carril i % 4), como en SIMD-BP128: cada fila de 4 valores se extrae con
+// un desplazamiento y una máscara de un vector de 128 bits, y la suma prefija del modo
+// delta es una suma vertical de filas. Un índice con el modo, los bits, la referencia y
+// la posición de cada bloque permite decodificar cualquier bloque por separado.
+//
+// Formato de archivo: una cabecera de 24 bytes ("DCMP", versión, número de enteros y
+// número de palabras de 32 bits), el índice (12 bytes por bloque) y las palabras, en el
+// orden de bytes de la máquina que lo escribe.
+
+const int BLOQUE_COMPRIMIDO = 128;                       // Enteros por bloque
+const int CARRILES_COMPRIMIDO = 4;                       // Carriles intercalados (un vector de 128 bits)
+const int FILAS_COMPRIMIDO = BLOQUE_COMPRIMIDO / CARRILES_COMPRIMIDO;
+
+/**
+ * @brief Codificación de un bloque.
+ */
+enum ModoBloque : uint8_t {
+    BLOQUE_REFERENCIA,  // x - referencia, con referencia = mínimo del bloque
+    BLOQUE_DELTA        // x[i] - x[i - 4], con referencia = primer valor del bloque
+};
+
+/**
+ * @brief Entrada del índice: cómo decodificar un bloque y dónde empiezan sus palabras.
+ */
+struct CabeceraBloque {
+    int32_t referencia = 0;
+    uint8_t bits = 0;          // Bits por entero, de 0 a 32; el bloque ocupa 4 * bits palabras
+    uint8_t modo = BLOQUE_REFERENCIA;
+    uint16_t reservado = 0;
+    uint32_t desplazamiento = 0;  // Primera palabra del bloque
+};
+
+static_assert(sizeof(CabeceraBloque) == 12, "Cada entrada del índice debe ocupar 12 bytes sin relleno");
+
+/**
+ * @brief Cabecera de un archivo comprimido.
+ */
+struct CabeceraComprimido {
+    char firma[4] = {'D', 'C', 'M', 'P'};
+    uint32_t version = 1;
+    uint64_t cantidad = 0;  // Enteros guardados
+    uint64_t palabras = 0;  // Palabras de 32 bits de datos empaquetados
+};
+
+static_assert(sizeof(CabeceraComprimido) == 24, "La cabecera comprimida debe ocupar 24 bytes sin relleno");
+
+/**
+ * @brief Bits necesarios para representar v (0 para v = 0).
+ */
+inline int bitsNecesarios(uint32_t v) {
+    int bits = 0;
+    while (v != 0) {
+        bits++;
+        v >>= 1;
+    }
+    return bits;
+}
+
+/**
+ * @brief Empaqueta 128 valores de 'bits' bits en 4 * bits palabras, carril por carril.
+ *
+ * El valor de la fila r del carril c (posición 4r + c del bloque) ocupa los bits
+ * [r·bits, (r + 1)·bits) del carril, y la palabra w del carril c está en palabras[4w + c].
+ */
+inline void empaquetarBloque(const uint32_t* valores, int bits, uint32_t* palabras) {
+    if (bits == 0) {
+        return;  // Todos los valores son cero: el bloque no ocupa palabras
+    }
+    std::fill(palabras, palabras + CARRILES_COMPRIMIDO * bits, 0u);
+    for (int c = 0; c < CARRILES_COMPRIMIDO; c++) {
+        for (int r = 0; r < FILAS_COMPRIMIDO; r++) {
+            uint32_t valor = valores[r * CARRILES_COMPRIMIDO + c];
+            int bit = r * bits;
+            int palabra = bit / 32;
+            int desplazamiento = bit % 32;
+            palabras[palabra * CARRILES_COMPRIMIDO + c] |= valor << desplazamiento;
+            if (desplazamiento + bits > 32) {
+                palabras[(palabra + 1) * CARRILES_COMPRIMIDO + c] |= valor >> (32 - desplazamiento);
+            }
+        }
+    }
+}
+
+#if defined(__SSE2__)
+/**
+ * @brief Extrae la fila R (4 valores) de un bloque empaquetado con BITS bits y la acumula según el modo.
+ *
+ * Con R y BITS constantes, las posiciones y desplazamientos son inmediatos.
+ */
+template <int BITS, int MODO, int R>
+inline void desempaquetarFila(const __m128i* palabras, __m128i referencia, __m128i& acumulado, int* salida) {
+    constexpr int bit = R * BITS;
+    constexpr int palabra = bit / 32;
+    constexpr int desplazamiento = bit % 32;
+
+    __m128i fila = _mm_setzero_si128();
+    if constexpr (BITS > 0) {
+        fila = _mm_srli_epi32(_mm_loadu_si128(palabras + palabra), desplazamiento);
+        if constexpr (desplazamiento + BITS > 32) {
+            fila = _mm_or_si128(fila, _mm_slli_epi32(_mm_loadu_si128(palabras + palabra + 1), 32 - desplazamiento));
+        }
+        if constexpr (BITS < 32) {
+            fila = _mm_and_si128(fila, _mm_set1_epi32(static_cast<int>((1u << BITS) - 1)));
+        }
+    }
+    if constexpr (MODO == BLOQUE_DELTA) {
+        acumulado = _mm_add_epi32(acumulado, fila);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(salida + R * CARRILES_COMPRIMIDO), acumulado);
+    } else {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(salida + R * CARRILES_COMPRIMIDO), _mm_add_epi32(fila, referencia));
+    }
+}
+
+template <int BITS, int MODO, std::size_t... R>
+inline void desempaquetarFilas(const uint32_t* palabras, int32_t referencia, int* salida, std::index_sequence<R...>) {
+    const __m128i* vectores = reinterpret_cast<const __m128i*>(palabras);
+    __m128i base = _mm_set1_epi32(referencia);
+    __m128i acumulado = base;
+    (desempaquetarFila<BITS, MODO, static_cast<int>(R)>(vectores, base, acumulado, salida), ...);
+}
+#endif
+
+/**
+ * @brief Decodifica los 128 enteros de un bloque empaquetado con BITS bits en el modo MODO.
+ */
+template <int BITS, int MODO>
+void desempaquetarBloque(const uint32_t* palabras, int32_t referencia, int* salida) {
+#if defined(__SSE2__)
+    desempaquetarFilas<BITS, MODO>(palabras, referencia, salida, std::make_index_sequence<FILAS_COMPRIMIDO>{});
+#else
+    const uint32_t mascara = BITS == 32 ? 0xFFFFFFFFu : (1u << BITS) - 1;
+    uint32_t acumulado[CARRILES_COMPRIMIDO];
+    std::fill(acumulado, acumulado + CARRILES_COMPRIMIDO, static_cast<uint32_t>(referencia));
+    for (int r = 0; r < FILAS_COMPRIMIDO; r++) {
+        int bit = r * BITS;
+        int palabra = bit / 32;
+        int desplazamiento = bit % 32;
+        for (int c = 0; c < CARRILES_COMPRIMIDO; c++) {
+            uint32_t valor = 0;
+            if (BITS > 0) {
+                valor = palabras[palabra * CARRILES_COMPRIMIDO + c] >> desplazamiento;
+                if (desplazamiento + BITS > 32) {
+                    valor |= palabras[(palabra + 1) * CARRILES_COMPRIMIDO + c] << (32 - desplazamiento);
+                }
+                valor &= mascara;
+            }
+            if (MODO == BLOQUE_DELTA) {
+                acumulado[c] += valor;
+                valor = acumulado[c];
+            } else {
+                valor += static_cast<uint32_t>(referencia);
+            }
+            salida[r * CARRILES_COMPRIMIDO + c] = static_cast<int>(valor);
+        }
+    }
+#endif
+}
+
+using DesempaquetadorBloque = void (*)(const uint32_t*, int32_t, int*);
+
+/**
+ * @brief Tabla con una instanciación de desempaquetarBloque por modo y número de bits (0 a 32).
+ */
+template <std::size_t... BITS>
+const DesempaquetadorBloque* tablaDesempaquetadores(std::index_sequence<BITS...>) {
+    static const DesempaquetadorBloque tabla[] = {&desempaquetarBloque<static_cast<int>(BITS), BLOQUE_REFERENCIA>...,
+                                                  &desempaquetarBloque<static_cast<int>(BITS), BLOQUE_DELTA>...};
+    return tabla;
+}
+
+/**
+ * @brief Decodifica un bloque según su entrada del índice; 'salida' debe tener sitio para 128 enteros.
+ */
+inline void decodificarBloqueEmpaquetado(const CabeceraBloque& cabecera, const uint32_t* palabras, int* salida) {
+    static const DesempaquetadorBloque* tabla = tablaDesempaquetadores(std::make_index_sequence<33>{});
+    tabla[cabecera.modo * 33 + cabecera.bits](palabras + cabecera.desplazamiento, cabecera.referencia, salida);
+}
+
+/**
+ * @brief Arreglo de enteros comprimido por bloques, con acceso directo a cada bloque.
+ */
+class DatasetComprimido {
+public:
+    DatasetComprimido() = default;
+
+    /**
+     * @brief Comprime n enteros eligiendo, por bloque, el modo con menos bits.
+     *
+     * A igual número de bits se prefiere el marco de referencia, que no necesita la suma prefija.
+     */
+    DatasetComprimido(const int* datos, std::size_t n) : cantidad(n) {
+        std::size_t numBloques = (n + BLOQUE_COMPRIMIDO - 1) / BLOQUE_COMPRIMIDO;
+        indice.resize(numBloques);
+        uint32_t valores[BLOQUE_COMPRIMIDO];
+
+        for (std::size_t b = 0; b < numBloques; b++) {
+            std::size_t primero = b * BLOQUE_COMPRIMIDO;
+            int enBloque = static_cast<int>(std::min<std::size_t>(BLOQUE_COMPRIMIDO, n - primero));
+            const int* x = datos + primero;
+
+            // El relleno del último bloque repite el último valor, que no cambia el mínimo ni rompe el orden
+            int bloque[BLOQUE_COMPRIMIDO];
+            std::copy(x, x + enBloque, bloque);
+            std::fill(bloque + enBloque, bloque + BLOQUE_COMPRIMIDO, x[enBloque - 1]);
+
+            int minimo = *std::min_element(bloque, bloque + BLOQUE_COMPRIMIDO);
+            int maximo = *std::max_element(bloque, bloque + BLOQUE_COMPRIMIDO);
+            int bitsReferencia = bitsNecesarios(static_cast<uint32_t>(maximo) - static_cast<uint32_t>(minimo));
+
+            bool monotono = true;
+            uint32_t mayorDelta = 0;
+            for (int i = 0; i < BLOQUE_COMPRIMIDO; i++) {
+                int anterior = i >= CARRILES_COMPRIMIDO ? bloque[i - CARRILES_COMPRIMIDO] : bloque[0];
+                if (bloque[i] < anterior) {
+                    monotono = false;
+                    break;
+                }
+                mayorDelta = std::max(mayorDelta, static_cast<uint32_t>(bloque[i]) - static_cast<uint32_t>(anterior));
+            }
+            int bitsDelta = monotono ? bitsNecesarios(mayorDelta) : 33;
+
+            CabeceraBloque& cabecera = indice[b];
+            cabecera.desplazamiento = static_cast<uint32_t>(palabras.size());
+            if (bitsDelta < bitsReferencia) {
+                cabecera.modo = BLOQUE_DELTA;
+                cabecera.bits = static_cast<uint8_t>(bitsDelta);
+                cabecera.referencia = bloque[0];
+                for (int i = 0; i < BLOQUE_COMPRIMIDO; i++) {
+                    int anterior = i >= CARRILES_COMPRIMIDO ? bloque[i - CARRILES_COMPRIMIDO] : bloque[0];
+                    valores[i] = static_cast<uint32_t>(bloque[i]) - static_cast<uint32_t>(anterior);
+                }
+            } else {
+                cabecera.modo = BLOQUE_REFERENCIA;
+                cabecera.bits = static_cast<uint8_t>(bitsReferencia);
+                cabecera.referencia = minimo;
+                for (int i = 0; i < BLOQUE_COMPRIMIDO; i++) {
+                    valores[i] = static_cast<uint32_t>(bloque[i]) - static_cast<uint32_t>(minimo);
+                }
+            }
+            palabras.resize(palabras.size() + CARRILES_COMPRIMIDO * cabecera.bits);
+            empaquetarBloque(valores, cabecera.bits, palabras.data() + cabecera.desplazamiento);
+        }
+    }
+
+    explicit DatasetComprimido(const std::vector<int>& datos) : DatasetComprimido(datos.data(), datos.size()) {}
+
+    std::size_t size() const {
+        return cantidad;
+    }
+
+    std::size_t bloques() const {
+        return indice.size();
+    }
+
+    /**
+     * @brief Bytes que ocupa en un archivo (cabecera, índice y palabras).
+     */
+    std::size_t bytes() const {
+        return sizeof(CabeceraComprimido) + indice.size() * sizeof(CabeceraBloque) + palabras.size() * sizeof(uint32_t);
+    }
+
+    const CabeceraBloque& cabeceraBloque(std::size_t bloque) const {
+        return indice[bloque];
+    }
+
+    /**
+     * @brief Decodifica un bloque; 'salida' debe tener sitio para 128 enteros aunque el bloque sea el último.
+     *
+     * @return int Enteros válidos del bloque (menos de 128 sólo en el último).
+     */
+    int decodificarBloque(std::size_t bloque, int* salida) const {
+        decodificarBloqueEmpaquetado(indice[bloque], palabras.data(), salida);
+        return static_cast<int>(std::min<std::size_t>(BLOQUE_COMPRIMIDO, cantidad - bloque * BLOQUE_COMPRIMIDO));
+    }
+
+    /**
+     * @brief Valor de la posición i, decodificando sólo su bloque.
+     */
+    int valor(std::size_t i) const {
+        int bloque[BLOQUE_COMPRIMIDO];
+        decodificarBloque(i / BLOQUE_COMPRIMIDO, bloque);
+        return bloque[i % BLOQUE_COMPRIMIDO];
+    }
+
+    /**
+     * @brief Decodifica todos los enteros en 'salida' (size() elementos).
+     *
+     * Los bloques completos se escriben directamente en 'salida'; el último, si está
+     * incompleto, pasa por un arreglo local.
+     */
+    void decodificar(int* salida) const {
+        std::size_t completos = cantidad / BLOQUE_COMPRIMIDO;
+        for (std::size_t b = 0; b < completos; b++) {
+            decodificarBloqueEmpaquetado(indice[b], palabras.data(), salida + b * BLOQUE_COMPRIMIDO);
+        }
+        if (completos < indice.size()) {
+            int ultimo[BLOQUE_COMPRIMIDO];
+            int validos = decodificarBloque(completos, ultimo);
+            std::copy(ultimo, ultimo + validos, salida + completos * BLOQUE_COMPRIMIDO);
+        }
+    }
+
+    std::vector<int> decodificar() const {
+        std::vector<int> datos(cantidad);
+        decodificar(datos.data());
+        return datos;
+    }
+
+    /**
+     * @brief Escribe el arreglo comprimido en un archivo.
+     */
+    bool guardar(const std::string& nombreArchivo) const {
+        CabeceraComprimido cabecera;
+        cabecera.cantidad = cantidad;
+        cabecera.palabras = palabras.size();
+
+        std::ofstream archivo(nombreArchivo, std::ios::binary | std::ios::trunc);
+        archivo.write(reinterpret_cast<const char*>(&cabecera), sizeof(cabecera));
+        archivo.write(reinterpret_cast<const char*>(indice.data()), indice.size() * sizeof(CabeceraBloque));
+        archivo.write(reinterpret_cast<const char*>(palabras.data()), palabras.size() * sizeof(uint32_t));
+        return static_cast<bool>(archivo);
+    }
+
+    /**
+     * @brief Lee un archivo comprimido completo.
+     *
+     * @return bool false si el archivo no existe, no tiene una cabecera válida o está truncado.
+     */
+    bool leer(const std::string& nombreArchivo) {
+        std::ifstream archivo(nombreArchivo, std::ios::binary);
+        CabeceraComprimido cabecera;
+        if (!leerCabecera(archivo, cabecera)) {
+            return false;
+        }
+        std::vector<CabeceraBloque> nuevoIndice((cabecera.cantidad + BLOQUE_COMPRIMIDO - 1) / BLOQUE_COMPRIMIDO);
+        std::vector<uint32_t> nuevasPalabras(cabecera.palabras);
+        if (!archivo.read(reinterpret_cast<char*>(nuevoIndice.data()), nuevoIndice.size() * sizeof(CabeceraBloque)) ||
+            !archivo.read(reinterpret_cast<char*>(nuevasPalabras.data()), nuevasPalabras.size() * sizeof(uint32_t))) {
+            return false;
+        }
+        for (const CabeceraBloque& bloque : nuevoIndice) {
+            if (bloque.bits > 32 || bloque.modo > BLOQUE_DELTA ||
+                static_cast<uint64_t>(bloque.desplazamiento) + CARRILES_COMPRIMIDO * bloque.bits > cabecera.palabras) {
+                return false;
+            }
+        }
+        cantidad = cabecera.cantidad;
+        indice = std::move(nuevoIndice);
+        palabras = std::move(nuevasPalabras);
+        return true;
+    }
+
+    /**
+     * @brief Decodifica un solo bloque de un archivo comprimido sin leer el resto.
+     *
+     * Lee la cabecera, la entrada del bloque en el índice y sus 4 * bits palabras.
+     *
+     * @param salida Sitio para 128 enteros.
+     * @return int Enteros válidos del bloque, o -1 si el archivo o el bloque no son válidos.
+     */
+    static int leerBloque(const std::string& nombreArchivo, std::size_t bloque, int* salida) {
+        std::ifstream archivo(nombreArchivo, std::ios::binary);
+        CabeceraComprimido cabecera;
+        if (!leerCabecera(archivo, cabecera) || bloque >= (cabecera.cantidad + BLOQUE_COMPRIMIDO - 1) / BLOQUE_COMPRIMIDO) {
+            return -1;
+        }
+        std::size_t numBloques = (cabecera.cantidad + BLOQUE_COMPRIMIDO - 1) / BLOQUE_COMPRIMIDO;
+        CabeceraBloque entrada;
+        archivo.seekg(sizeof(CabeceraComprimido) + bloque * sizeof(CabeceraBloque));
+        if (!archivo.read(reinterpret_cast<char*>(&entrada), sizeof(entrada)) || entrada.bits > 32 || entrada.modo > BLOQUE_DELTA ||
+            static_cast<uint64_t>(entrada.desplazamiento) + CARRILES_COMPRIMIDO * entrada.bits > cabecera.palabras) {
+            return -1;
+        }
+        std::vector<uint32_t> palabrasBloque(CARRILES_COMPRIMIDO * entrada.bits);
+        archivo.seekg(sizeof(CabeceraComprimido) + numBloques * sizeof(CabeceraBloque) + entrada.desplazamiento * sizeof(uint32_t));
+        if (!archivo.read(reinterpret_cast<char*>(palabrasBloque.data()), palabrasBloque.size() * sizeof(uint32_t))) {
+            return -1;
+        }
+        entrada.desplazamiento = 0;
+        decodificarBloqueEmpaquetado(entrada, palabrasBloque.data(), salida);
+        return static_cast<int>(std::min<uint64_t>(BLOQUE_COMPRIMIDO, cabecera.cantidad - bloque * BLOQUE_COMPRIMIDO));
+    }
+
+private:
+    std::size_t cantidad = 0;
+    std::vector<CabeceraBloque> indice;
+    std::vector<uint32_t> palabras;
+
+    static bool leerCabecera(std::ifstream& archivo, CabeceraComprimido& cabecera) {
+        return archivo.read(reinterpret_cast<char*>(&cabecera), sizeof(cabecera)) && std::memcmp(cabecera.firma, "DCMP", 4) == 0 &&
+               cabecera.version == 1;
+    }
+};
+
+/**
+ * @brief Nombre de la versión comprimida de un archivo de dataset: cambia ".txt" por ".dcmp".
+ */
+inline std::string archivoDatasetComprimido(const std::string& archivoTexto) {
+    std::string base = archivoTexto;
+    if (base.size() > 4 && base.compare(base.size() - 4, 4, ".txt") == 0) {
+        base.resize(base.size() - 4);
+    }
+    return base + ".dcmp";
+}
+
+/**
+ * @brief Comprime un dataset y lo guarda en un archivo.
+ */
+inline bool guardarDatasetComprimido(const std::vector<int>& dataset, const std::string& nombreArchivo) {
+    return DatasetComprimido(dataset).guardar(nombreArchivo);
+}
+
+/**
+ * @brief Lee un dataset de su versión comprimida si existe y, si no, del archivo de texto.
+ *
+ * La versión comprimida se ignora si es más antigua que el texto (el dataset se volvió a
+ * generar sin ella).
+ */
+inline std::vector<int> leerDatasetPreferiblementeComprimido(const std::string& archivoTexto) {
+    std::string archivoComprimido = archivoDatasetComprimido(archivoTexto);
+    std::error_code error;
+    auto fechaComprimido = std::filesystem::last_write_time(archivoComprimido, error);
+    if (!error) {
+        std::error_code errorTexto;
+        auto fechaTexto = std::filesystem::last_write_time(archivoTexto, errorTexto);
+        DatasetComprimido comprimido;
+        if ((errorTexto || fechaComprimido >= fechaTexto) && comprimido.leer(archivoComprimido)) {
+            return comprimido.decodificar();
+        }
+    }
+    return leerDatasetDesdeArchivo(archivoTexto);
+}
+
+#endif
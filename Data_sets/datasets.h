@@ -0,0 +1,156 @@
+#ifndef DATASETS_H
+#define DATASETS_H
+
+#include <vector>
+#include <string>
+#include <fstream>
+
+/**
+ * @brief Lee un dataset desde un archivo de texto y lo carga en un vector de enteros.
+ *
+ * @param nombreArchivo Nombre del archivo que contiene los datos.
+ * @return std::vector<int> Vector que contiene el dataset leído.
+ */
+inline std::vector<int> leerDatasetDesdeArchivo(const std::string& nombreArchivo) {
+    std::vector<int> dataset;
+    std::ifstream archivo(nombreArchivo);
+    int numero;
+
+    // Leer el archivo y cargar los números en el vector
+    while (archivo >> numero) {
+        dataset.push_back(numero);
+    }
+
+    archivo.close();
+    return dataset;
+}
+
+/**
+ * @brief Extrae la descripción del tipo de dataset y su tamaño a partir del nombre del archivo.
+ *
+ * @param nombreArchivo Nombre del archivo que contiene el dataset.
+ * @return std::string Descripción del dataset.
+ */
+inline std::string obtenerDescripcionDataset(const std::string& nombreArchivo) {
+    std::string descripcion;
+
+    // Determinar el tipo de dataset
+    if (nombreArchivo.find("aleatorio") != std::string::npos) {
+        descripcion = "dataset aleatorio";
+    } else if (nombreArchivo.find("parcialmente_ordenado") != std::string::npos) {
+        descripcion = "dataset parcialmente ordenado";
+    } else if (nombreArchivo.find("ordenado") != std::string::npos) {
+        descripcion = "dataset ordenado";
+    }
+
+    // Determinar el tamaño del dataset según el nombre del archivo
+    if (nombreArchivo.find("100000") != std::string::npos) {
+        descripcion += " de 100000 elementos";
+    } else if (nombreArchivo.find("10000") != std::string::npos) {
+        descripcion += " de 10000 elementos";
+    } else if (nombreArchivo.find("1000") != std::string::npos) {
+        descripcion += " de 1000 elementos";
+    }
+
+    return descripcion;
+}
+
+/**
+ * @brief Archivos generados por "Dataset para Ordenamiento.cpp", en el orden en que se miden.
+ */
+inline std::vector<std::string> archivosOrdenamiento() {
+    return {
+        "dataset_aleatorio_1000.txt", "dataset_parcialmente_ordenado_1000.txt", "dataset_ordenado_1000.txt",
+        "dataset_aleatorio_10000.txt", "dataset_parcialmente_ordenado_10000.txt", "dataset_ordenado_10000.txt",
+        "dataset_aleatorio_100000.txt", "dataset_parcialmente_ordenado_100000.txt", "dataset_ordenado_100000.txt"
+    };
+}
+
+/**
+ * @brief Lee una matriz desde un archivo y la carga en una estructura vectorial 2D.
+ *
+ * @param nombreArchivo Nombre del archivo que contiene la matriz.
+ * @param filas Número de filas de la matriz.
+ * @param columnas Número de columnas de la matriz.
+ * @return std::vector<std::vector<int>> Matriz leída desde el archivo.
+ */
+inline std::vector<std::vector<int>> leerMatrizDesdeArchivo(const std::string& nombreArchivo, int filas, int columnas) {
+    std::vector<std::vector<int>> matriz(filas, std::vector<int>(columnas));
+    std::ifstream archivo(nombreArchivo);
+
+    // Leer los datos desde el archivo y almacenarlos en la matriz
+    for (int i = 0; i < filas; i++) {
+        for (int j = 0; j < columnas; j++) {
+            archivo >> matriz[i][j];
+        }
+    }
+
+    archivo.close();
+    return matriz;
+}
+
+/**
+ * @brief Producto A (filasA x columnasA) por B (columnasA x columnasB) leído desde dos archivos.
+ */
+struct CasoMatrices {
+    std::string archivoA;
+    std::string archivoB;
+    int filasA;
+    int columnasA;
+    int columnasB;
+    int densidad = 100;  // Porcentaje aproximado de elementos distintos de cero
+};
+
+/**
+ * @brief Casos generados por "Dataset para Multiplicación de Matrices.cpp", en el orden en que se miden.
+ */
+inline std::vector<CasoMatrices> casosMatrices() {
+    return {
+        // Multiplicación de matrices cuadradas
+        {"matriz_100x100.txt", "matriz_100x100.txt", 100, 100, 100},
+        {"matriz_500x500.txt", "matriz_500x500.txt", 500, 500, 500},
+        {"matriz_1000x1000.txt", "matriz_1000x1000.txt", 1000, 1000, 1000},
+
+        // Multiplicación de matrices no cuadradas
+        {"matriz_100x500.txt", "matriz_500x1000.txt", 100, 500, 1000}
+    };
+}
+
+/**
+ * @brief Porcentajes de elementos no nulos de las matrices dispersas generadas.
+ */
+inline std::vector<int> densidadesDispersas() {
+    return {1, 5, 20};
+}
+
+/**
+ * @brief Nombre del archivo de la matriz dispersa de tamano x tamano con la densidad dada.
+ */
+inline std::string archivoMatrizDispersa(int tamano, int densidad) {
+    return "matriz_dispersa_" + std::to_string(tamano) + "x" + std::to_string(tamano) + "_" + std::to_string(densidad) + ".txt";
+}
+
+/**
+ * @brief Nombre de la versión binaria (ver fuera_de_memoria.h) de un archivo de matriz de texto: cambia ".txt" por ".bin".
+ */
+inline std::string archivoMatrizBinaria(const std::string& archivoTexto) {
+    std::string base = archivoTexto;
+    if (base.size() > 4 && base.compare(base.size() - 4, 4, ".txt") == 0) {
+        base.resize(base.size() - 4);
+    }
+    return base + ".bin";
+}
+
+/**
+ * @brief Casos con matrices dispersas de 1000x1000, uno por densidad, para comparar con los densos.
+ */
+inline std::vector<CasoMatrices> casosMatricesDispersas() {
+    std::vector<CasoMatrices> casos;
+    for (int densidad : densidadesDispersas()) {
+        std::string archivo = archivoMatrizDispersa(1000, densidad);
+        casos.push_back({archivo, archivo, 1000, 1000, 1000, densidad});
+    }
+    return casos;
+}
+
+#endif
@@ -0,0 +1,476 @@
+#ifndef MEMORIA_NUMA_H
+#define MEMORIA_NUMA_H
+
+#include <vector>
+#include <string>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+#include <new>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#endif
+
+// Capa de asignación y afinidad para los núcleos paralelos. En Linux, una página se
+// coloca en el nodo NUMA del hilo que la escribe por primera vez, así que un buffer
+// reservado e inicializado por un solo hilo queda entero en un nodo. Aquí los buffers
+// se reservan sin tocarlos (mmap), alineados a 2 MiB y con páginas grandes, y cada
+// trabajador de un GrupoHilos fijado a un núcleo inicializa la parte que luego procesa.
+
+const std::size_t PAGINA_NORMAL = 4096;
+const std::size_t PAGINA_GRANDE = 2 << 20;
+
+#if defined(__linux__) && defined(MAP_HUGE_SHIFT)
+const int BANDERA_HUGETLB_2MB = 21 << MAP_HUGE_SHIFT;  // log2(2 MiB); sin ella se usa el tamaño por defecto del sistema
+#else
+const int BANDERA_HUGETLB_2MB = 0;
+#endif
+
+/**
+ * @brief Tipo de páginas con que se respalda un BufferGrande.
+ */
+enum PaginasBuffer {
+    PAGINAS_NORMALES,  // 4 KiB, con las páginas grandes transparentes desactivadas para el buffer
+    PAGINAS_THP,       // Páginas grandes transparentes (madvise(MADV_HUGEPAGE)) sobre memoria alineada a 2 MiB
+    PAGINAS_HUGETLB    // Páginas de 2 MiB reservadas en hugetlbfs (vm.nr_hugepages); si no hay, THP
+};
+
+inline const char* nombrePaginas(PaginasBuffer paginas) {
+    switch (paginas) {
+        case PAGINAS_NORMALES: return "páginas de 4 KiB";
+        case PAGINAS_THP: return "THP de 2 MiB";
+        case PAGINAS_HUGETLB: return "hugetlbfs de 2 MiB";
+    }
+    return "";
+}
+
+/**
+ * @brief Cómo reservan e inicializan la memoria los núcleos paralelos.
+ */
+struct ConfiguracionNuma {
+    PaginasBuffer paginas = PAGINAS_THP;
+    bool primerToque = true;  // Cada trabajador inicializa su parte; si no, lo hace el hilo que llama
+    bool fijarHilos = true;   // Fija cada trabajador a un núcleo, repartidos entre los nodos
+    int hilos = 0;            // 0: los que indique el hardware
+};
+
+/**
+ * @brief Interpreta una lista de CPUs del kernel ("0-3,8,10-11").
+ */
+inline std::vector<int> leerListaCpus(const std::string& texto) {
+    std::vector<int> cpus;
+    std::stringstream flujo(texto);
+    std::string rango;
+    while (std::getline(flujo, rango, ',')) {
+        if (rango.empty() || rango[0] < '0' || rango[0] > '9') {
+            continue;
+        }
+        std::size_t guion = rango.find('-');
+        int primera = std::atoi(rango.c_str());
+        int ultima = guion == std::string::npos ? primera : std::atoi(rango.c_str() + guion + 1);
+        for (int cpu = primera; cpu <= ultima; cpu++) {
+            cpus.push_back(cpu);
+        }
+    }
+    return cpus;
+}
+
+/**
+ * @brief CPUs que el proceso puede usar (todas las que indique el hardware si no se pueden consultar).
+ */
+inline std::vector<int> cpusPermitidas() {
+    std::vector<int> cpus;
+#ifdef __linux__
+    cpu_set_t conjunto;
+    CPU_ZERO(&conjunto);
+    if (sched_getaffinity(0, sizeof(conjunto), &conjunto) == 0) {
+        for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+            if (CPU_ISSET(cpu, &conjunto)) {
+                cpus.push_back(cpu);
+            }
+        }
+    }
+#endif
+    if (cpus.empty()) {
+        int total = std::max(1u, std::thread::hardware_concurrency());
+        for (int cpu = 0; cpu < total; cpu++) {
+            cpus.push_back(cpu);
+        }
+    }
+    return cpus;
+}
+
+/**
+ * @brief CPUs permitidas agrupadas por nodo NUMA, leídas de /sys/devices/system/node.
+ *
+ * Sin información de nodos (o fuera de Linux) se devuelve un único nodo con todas.
+ */
+inline std::vector<std::vector<int>> cpusPorNodo() {
+    std::vector<int> permitidas = cpusPermitidas();
+    std::vector<std::vector<int>> nodos;
+    for (int nodo = 0;; nodo++) {
+        std::ifstream archivo("/sys/devices/system/node/node" + std::to_string(nodo) + "/cpulist");
+        std::string lista;
+        if (!archivo || !std::getline(archivo, lista)) {
+            break;
+        }
+        std::vector<int> cpus;
+        for (int cpu : leerListaCpus(lista)) {
+            if (std::find(permitidas.begin(), permitidas.end(), cpu) != permitidas.end()) {
+                cpus.push_back(cpu);
+            }
+        }
+        if (!cpus.empty()) {
+            nodos.push_back(std::move(cpus));
+        }
+    }
+    if (nodos.empty()) {
+        nodos.push_back(permitidas);
+    }
+    return nodos;
+}
+
+/**
+ * @brief CPUs en el orden en que se asignan los trabajadores: alternando entre nodos.
+ *
+ * Con dos nodos el orden es nodo 0, nodo 1, nodo 0, ...; así cualquier número de
+ * hilos usa el ancho de banda de memoria de todos los nodos.
+ */
+inline std::vector<int> ordenCpusRepartido() {
+    std::vector<std::vector<int>> nodos = cpusPorNodo();
+    std::vector<int> orden;
+    for (std::size_t i = 0;; i++) {
+        bool quedan = false;
+        for (const std::vector<int>& cpus : nodos) {
+            if (i < cpus.size()) {
+                orden.push_back(cpus[i]);
+                quedan = true;
+            }
+        }
+        if (!quedan) {
+            break;
+        }
+    }
+    return orden;
+}
+
+/**
+ * @brief Fija un hilo a una CPU.
+ *
+ * @return bool false si la plataforma no lo permite.
+ */
+inline bool fijarHiloACpu(std::thread& hilo, int cpu) {
+#ifdef __linux__
+    cpu_set_t conjunto;
+    CPU_ZERO(&conjunto);
+    CPU_SET(cpu, &conjunto);
+    return pthread_setaffinity_np(hilo.native_handle(), sizeof(conjunto), &conjunto) == 0;
+#else
+    (void)hilo;
+    (void)cpu;
+    return false;
+#endif
+}
+
+/**
+ * @brief Arreglo de n elementos triviales en memoria alineada a 2 MiB, reservado sin tocarlo.
+ *
+ * La memoria viene de mmap y vale cero; ninguna página existe hasta que se escribe, de modo
+ * que el hilo que la inicializa decide en qué nodo queda. Si no se pueden obtener páginas
+ * de hugetlbfs se recurre a THP, y paginas() indica lo que se obtuvo realmente.
+ */
+template <class T>
+class BufferGrande {
+    static_assert(std::is_trivially_copyable<T>::value && std::is_trivially_default_constructible<T>::value,
+                  "BufferGrande no construye sus elementos");
+
+public:
+    BufferGrande() = default;
+
+    BufferGrande(std::size_t n, PaginasBuffer paginas) {
+        reservar(n, paginas);
+    }
+
+    BufferGrande(const BufferGrande&) = delete;
+    BufferGrande& operator=(const BufferGrande&) = delete;
+
+    BufferGrande(BufferGrande&& otro) noexcept {
+        *this = std::move(otro);
+    }
+
+    BufferGrande& operator=(BufferGrande&& otro) noexcept {
+        if (this != &otro) {
+            liberar();
+            std::swap(datos, otro.datos);
+            std::swap(cantidad, otro.cantidad);
+            std::swap(bytes, otro.bytes);
+            std::swap(tipo, otro.tipo);
+        }
+        return *this;
+    }
+
+    ~BufferGrande() {
+        liberar();
+    }
+
+    T* data() { return datos; }
+    const T* data() const { return datos; }
+    std::size_t size() const { return cantidad; }
+    T* begin() { return datos; }
+    T* end() { return datos + cantidad; }
+    const T* begin() const { return datos; }
+    const T* end() const { return datos + cantidad; }
+    T& operator[](std::size_t i) { return datos[i]; }
+    const T& operator[](std::size_t i) const { return datos[i]; }
+
+    /**
+     * @brief Páginas con que quedó respaldado el buffer.
+     */
+    PaginasBuffer paginas() const {
+        return tipo;
+    }
+
+private:
+    T* datos = nullptr;
+    std::size_t cantidad = 0;
+    std::size_t bytes = 0;
+    PaginasBuffer tipo = PAGINAS_NORMALES;
+
+    void reservar(std::size_t n, PaginasBuffer paginas) {
+        cantidad = n;
+        if (n == 0) {
+            return;
+        }
+        std::size_t pagina = paginas == PAGINAS_NORMALES ? PAGINA_NORMAL : PAGINA_GRANDE;
+        bytes = (n * sizeof(T) + pagina - 1) / pagina * pagina;
+        tipo = paginas;
+#ifdef __linux__
+        void* memoria = MAP_FAILED;
+#ifdef MAP_HUGETLB
+        if (paginas == PAGINAS_HUGETLB) {
+            memoria = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | BANDERA_HUGETLB_2MB, -1, 0);
+        }
+#endif
+        if (memoria == MAP_FAILED && paginas != PAGINAS_NORMALES) {
+            tipo = PAGINAS_THP;
+            memoria = reservarAlineada();
+#ifdef MADV_HUGEPAGE
+            if (memoria != MAP_FAILED) {
+                madvise(memoria, bytes, MADV_HUGEPAGE);
+            }
+#endif
+        } else if (paginas == PAGINAS_NORMALES) {
+            memoria = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+#ifdef MADV_NOHUGEPAGE
+            // Con THP en "always" el kernel usaría páginas grandes igualmente
+            if (memoria != MAP_FAILED) {
+                madvise(memoria, bytes, MADV_NOHUGEPAGE);
+            }
+#endif
+        }
+        if (memoria == MAP_FAILED) {
+            throw std::bad_alloc();
+        }
+        datos = static_cast<T*>(memoria);
+#else
+        tipo = PAGINAS_NORMALES;
+        datos = static_cast<T*>(std::aligned_alloc(PAGINA_GRANDE, (n * sizeof(T) + PAGINA_GRANDE - 1) / PAGINA_GRANDE * PAGINA_GRANDE));
+        if (!datos) {
+            throw std::bad_alloc();
+        }
+        std::fill(datos, datos + n, T());
+#endif
+    }
+
+#ifdef __linux__
+    /**
+     * @brief Reserva 'bytes' alineados a PAGINA_GRANDE: pide de más y devuelve los extremos sobrantes.
+     */
+    void* reservarAlineada() {
+        std::size_t total = bytes + PAGINA_GRANDE;
+        void* memoria = mmap(nullptr, total, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (memoria == MAP_FAILED) {
+            return memoria;
+        }
+        char* inicio = static_cast<char*>(memoria);
+        char* alineado = reinterpret_cast<char*>((reinterpret_cast<std::uintptr_t>(inicio) + PAGINA_GRANDE - 1) / PAGINA_GRANDE * PAGINA_GRANDE);
+        if (alineado > inicio) {
+            munmap(inicio, alineado - inicio);
+        }
+        std::size_t sobrante = inicio + total - (alineado + bytes);
+        if (sobrante > 0) {
+            munmap(alineado + bytes, sobrante);
+        }
+        return alineado;
+    }
+#endif
+
+    void liberar() {
+        if (datos) {
+#ifdef __linux__
+            munmap(datos, bytes);
+#else
+            std::free(datos);
+#endif
+        }
+        datos = nullptr;
+        cantidad = 0;
+        bytes = 0;
+    }
+};
+
+/**
+ * @brief Trabajadores persistentes, opcionalmente fijados a núcleos repartidos entre nodos.
+ *
+ * El trabajador h ejecuta siempre la parte h de cada tarea, así que los datos que
+ * inicializa con el primer toque son los mismos que después procesa, en la memoria de su
+ * nodo. El hilo que llama a ejecutar sólo espera.
+ */
+class GrupoHilos {
+public:
+    explicit GrupoHilos(int hilos = 0, bool fijar = true) {
+        if (hilos <= 0) {
+            hilos = std::max(1u, std::thread::hardware_concurrency());
+        }
+        std::vector<int> orden = ordenCpusRepartido();
+        total = hilos;
+        asignadas.assign(hilos, -1);
+        trabajadores.reserve(hilos);
+        for (int h = 0; h < hilos; h++) {
+            trabajadores.emplace_back([this, h]() { trabajar(h); });
+            if (fijar && fijarHiloACpu(trabajadores.back(), orden[h % orden.size()])) {
+                asignadas[h] = orden[h % orden.size()];
+            }
+        }
+    }
+
+    GrupoHilos(const GrupoHilos&) = delete;
+    GrupoHilos& operator=(const GrupoHilos&) = delete;
+
+    ~GrupoHilos() {
+        {
+            std::lock_guard<std::mutex> bloqueo(mutex);
+            terminar = true;
+        }
+        hayTarea.notify_all();
+        for (std::thread& trabajador : trabajadores) {
+            trabajador.join();
+        }
+    }
+
+    int cantidad() const {
+        return total;
+    }
+
+    /**
+     * @brief CPU a la que está fijado cada trabajador (-1 si no está fijado).
+     */
+    const std::vector<int>& cpus() const {
+        return asignadas;
+    }
+
+    /**
+     * @brief Ejecuta tarea(h, cantidad()) en cada trabajador h y espera a que terminen todos.
+     */
+    void ejecutar(const std::function<void(int, int)>& tarea) {
+        std::unique_lock<std::mutex> bloqueo(mutex);
+        actual = &tarea;
+        pendientes = cantidad();
+        generacion++;
+        hayTarea.notify_all();
+        terminada.wait(bloqueo, [this]() { return pendientes == 0; });
+        actual = nullptr;
+    }
+
+private:
+    std::vector<std::thread> trabajadores;
+    std::vector<int> asignadas;
+    int total = 0;
+    std::mutex mutex;
+    std::condition_variable hayTarea;
+    std::condition_variable terminada;
+    const std::function<void(int, int)>* actual = nullptr;
+    unsigned long long generacion = 0;
+    int pendientes = 0;
+    bool terminar = false;
+
+    void trabajar(int h) {
+        unsigned long long vista = 0;
+        for (;;) {
+            const std::function<void(int, int)>* tarea;
+            {
+                std::unique_lock<std::mutex> bloqueo(mutex);
+                hayTarea.wait(bloqueo, [&]() { return terminar || generacion != vista; });
+                if (terminar) {
+                    return;
+                }
+                vista = generacion;
+                tarea = actual;
+            }
+            (*tarea)(h, total);
+            {
+                std::lock_guard<std::mutex> bloqueo(mutex);
+                if (--pendientes == 0) {
+                    terminada.notify_one();
+                }
+            }
+        }
+    }
+};
+
+/**
+ * @brief Rango [primero, ultimo) de la parte h de n elementos repartidos entre 'hilos', en múltiplos de 'granulo'.
+ */
+inline std::pair<std::size_t, std::size_t> rangoHilo(std::size_t n, int h, int hilos, std::size_t granulo = 1) {
+    std::size_t unidades = (n + granulo - 1) / granulo;
+    std::size_t primero = std::min(n, unidades * h / hilos * granulo);
+    std::size_t ultimo = std::min(n, unidades * (h + 1) / hilos * granulo);
+    return {primero, ultimo};
+}
+
+/**
+ * @brief Ejecuta inicializar(primero, ultimo) sobre las partes de n elementos.
+ *
+ * Con primer toque cada parte la escribe el trabajador que la procesará; sin él, el hilo
+ * que llama recorre todas las partes, como ocurre al copiar un vector reservado en main.
+ */
+template <class Inicializar>
+void inicializarPorPartes(GrupoHilos& grupo, const ConfiguracionNuma& configuracion, std::size_t n, std::size_t granulo, Inicializar inicializar) {
+    if (configuracion.primerToque) {
+        grupo.ejecutar([&](int h, int hilos) {
+            std::pair<std::size_t, std::size_t> rango = rangoHilo(n, h, hilos, granulo);
+            inicializar(rango.first, rango.second);
+        });
+    } else {
+        inicializar(std::size_t(0), n);
+    }
+}
+
+/**
+ * @brief Copia n elementos a un BufferGrande nuevo; con primer toque, cada trabajador copia su parte.
+ *
+ * Sirve para cargar un dataset leído por el hilo principal de modo que cada trabajador
+ * tenga su parte en la memoria de su nodo.
+ */
+template <class T>
+BufferGrande<T> copiarABufferGrande(const T* origen, std::size_t n, GrupoHilos& grupo, const ConfiguracionNuma& configuracion) {
+    BufferGrande<T> buffer(n, configuracion.paginas);
+    inicializarPorPartes(grupo, configuracion, n, 1, [&](std::size_t primero, std::size_t ultimo) {
+        std::copy(origen + primero, origen + ultimo, buffer.data() + primero);
+    });
+    return buffer;
+}
+
+#endif
@@ -0,0 +1,35 @@
+#include <iostream>
+#include <vector>
+#include "cadena.h"
+#include "../Benchmark/benchmark.h"
+#include "../Benchmark/algoritmos.h"
+
+using namespace std;
+
+/**
+ * @brief Función principal que planifica y multiplica cadenas de matrices.
+ *
+ * Para cada cadena muestra primero el plan óptimo frente al de izquierda a derecha, con
+ * el multiplicador, los flops previstos y reales y el tiempo de cada producto; después
+ * mide ambos planes con el benchmark.
+ *
+ * @return int Código de estado de la ejecución.
+ */
+int main(int argc, char* argv[]) {
+    for (const vector<int>& dimensiones : cadenasMatrices()) {
+        vector<vector<vector<double>>> matrices = generarCadena(dimensiones);
+        cout << "Cadena de " << matrices.size() << " matrices" << endl;
+
+        InformeCadena informe;
+        ejecutarCadena(matrices, planificarCadena(dimensiones), NUCLEO_AUTOMATICO, &informe);
+        imprimirInformeCadena(cout, informe);
+        ejecutarCadena(matrices, planIzquierdaADerecha(dimensiones), NUCLEO_AUTOMATICO, &informe);
+        imprimirInformeCadena(cout, informe);
+        cout << endl;
+    }
+
+    RegistroBenchmark registro;
+    agregarCadenasMatrices(registro);
+
+    return ejecutarBenchmark(registro, argc, argv);
+}
@@ -0,0 +1,32 @@
+#include <iostream>
+#include <vector>
+#include "matrices.h"
+#include "dispersa.h"
+#include "../Benchmark/benchmark.h"
+#include "../Benchmark/algoritmos.h"
+
+using namespace std;
+
+/**
+ * @brief Función principal que compara los productos dispersos (CSR) con la multiplicación densa optimizada.
+ *
+ * Mide las matrices de 1000x1000 con densidades del 1%, 5% y 20%, además de la densa,
+ * para ver a partir de qué densidad conviene el formato disperso.
+ *
+ * @return int Código de estado de la ejecución.
+ */
+int main(int argc, char* argv[]) {
+    RegistroBenchmark registro;
+    registro.registrarMultiplicacion("Multiplicación Optimizada", [](const vector<vector<int>>& A, const vector<vector<int>>& B) {
+        return multiplicarMatricesOptimizado(A, B, A.size(), B.size(), B[0].size());
+    });
+
+    vector<CasoMatrices> casos = casosMatricesDispersas();
+    casos.push_back({"matriz_1000x1000.txt", "matriz_1000x1000.txt", 1000, 1000, 1000});
+    for (const CasoMatrices& caso : casos) {
+        registro.agregarCasoMatrices(caso);
+    }
+    agregarMultiplicacionDispersa(registro, casos);
+
+    return ejecutarBenchmark(registro, argc, argv);
+}
@@ -0,0 +1,25 @@
+#include <iostream>
+#include <vector>
+#include "gemm_estrecho.h"
+#include "../Benchmark/benchmark.h"
+
+using namespace std;
+
+/**
+ * @brief Función principal que realiza la multiplicación de matrices con enteros estrechos (int8/int16) y mide el tiempo de ejecución.
+ * 
+ * @return int Código de estado de la ejecución.
+ */
+int main(int argc, char* argv[]) {
+    RegistroBenchmark registro;
+    registro.registrarMultiplicacion("Multiplicación Entera Estrecha", [](const vector<vector<int>>& A, const vector<vector<int>>& B) {
+        return multiplicarMatricesEstrecho(A, B);
+    });
+
+    // Multiplicación de matrices cuadradas y no cuadradas
+    for (const CasoMatrices& caso : casosMatrices()) {
+        registro.agregarCasoMatrices(caso);
+    }
+
+    return ejecutarBenchmark(registro, argc, argv);
+}
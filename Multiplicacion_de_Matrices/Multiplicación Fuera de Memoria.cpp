@@ -0,0 +1,44 @@
+#include <iostream>
+#include <vector>
+#include "fuera_de_memoria.h"
+#include "../Benchmark/benchmark.h"
+#include "../Benchmark/algoritmos.h"
+
+using namespace std;
+
+/**
+ * @brief Función principal que multiplica las matrices de los casos desde sus archivos binarios.
+ *
+ * Para cada caso convierte los archivos de texto a binario, muestra las teselas, la E/S y
+ * el tiempo de espera con cada presupuesto de memoria, y después lo mide con el benchmark.
+ *
+ * @return int Código de estado de la ejecución.
+ */
+int main(int argc, char* argv[]) {
+    for (const CasoMatrices& caso : casosMatrices()) {
+        string binarioA = archivoMatrizBinaria(caso.archivoA);
+        string binarioB = archivoMatrizBinaria(caso.archivoB);
+        if (!convertirTextoABinario<int>(caso.archivoA, binarioA, caso.filasA, caso.columnasA) ||
+            !convertirTextoABinario<int>(caso.archivoB, binarioB, caso.columnasA, caso.columnasB)) {
+            cerr << "No se pudieron convertir " << caso.archivoA << " y " << caso.archivoB << endl;
+            continue;
+        }
+
+        cout << RegistroBenchmark::descripcionCaso(caso) << endl;
+        for (size_t presupuesto : presupuestosFueraDeMemoria()) {
+            InformeFueraDeMemoria informe;
+            cout << " Presupuesto de " << (presupuesto >> 10) << " KiB" << endl;
+            if (!multiplicarFueraDeMemoria<int>(binarioA, binarioB, "producto.bin", presupuesto, &informe)) {
+                cerr << "  La multiplicación falló" << endl;
+                continue;
+            }
+            imprimirInformeFueraDeMemoria(cout, informe);
+        }
+        cout << endl;
+    }
+
+    RegistroBenchmark registro;
+    agregarMultiplicacionFueraDeMemoria(registro, casosMatrices());
+
+    return ejecutarBenchmark(registro, argc, argv);
+}
@@ -0,0 +1,35 @@
+#include <iostream>
+#include <vector>
+#include "matrices.h"
+#include "morton.h"
+#include "../Benchmark/benchmark.h"
+
+using namespace std;
+
+/**
+ * @brief Función principal que compara la multiplicación recursiva sobre Morton con la optimizada y la de bloques.
+ *
+ * @return int Código de estado de la ejecución.
+ */
+int main(int argc, char* argv[]) {
+    RegistroBenchmark registro;
+    registro.registrarMultiplicacion("Multiplicación Optimizada", [](const vector<vector<int>>& A, const vector<vector<int>>& B) {
+        return multiplicarMatricesOptimizado(A, B, A.size(), B.size(), B[0].size());
+    });
+    registro.registrarMultiplicacion("Multiplicación por Bloques", [](const vector<vector<int>>& A, const vector<vector<int>>& B) {
+        return multiplicarMatricesBloques(A, B);
+    });
+    registro.registrarMultiplicacion("Multiplicación Morton", [](const vector<vector<int>>& A, const vector<vector<int>>& B) {
+        return multiplicarMatricesMorton(A, B);
+    });
+    registro.registrarMultiplicacion("Strassen sobre Morton", [](const vector<vector<int>>& A, const vector<vector<int>>& B) {
+        return strassenMultiplicacionMorton(A, B);
+    });
+
+    // Multiplicación de matrices cuadradas y no cuadradas
+    for (const CasoMatrices& caso : casosMatrices()) {
+        registro.agregarCasoMatrices(caso);
+    }
+
+    return ejecutarBenchmark(registro, argc, argv);
+}
@@ -0,0 +1,25 @@
+#include <iostream>
+#include <vector>
+#include "matrices.h"
+#include "../Benchmark/benchmark.h"
+
+using namespace std;
+
+/**
+ * @brief Función principal que realiza la multiplicación de matrices por bloques y mide el tiempo de ejecución.
+ * 
+ * @return int Código de estado de la ejecución.
+ */
+int main(int argc, char* argv[]) {
+    RegistroBenchmark registro;
+    registro.registrarMultiplicacion("Multiplicación por Bloques", [](const vector<vector<int>>& A, const vector<vector<int>>& B) {
+        return multiplicarMatricesBloques(A, B);
+    });
+
+    // Multiplicación de matrices cuadradas y no cuadradas
+    for (const CasoMatrices& caso : casosMatrices()) {
+        registro.agregarCasoMatrices(caso);
+    }
+
+    return ejecutarBenchmark(registro, argc, argv);
+}
@@ -0,0 +1,21 @@
+#include <iostream>
+#include <vector>
+#include "lotes.h"
+#include "../Benchmark/benchmark.h"
+#include "../Benchmark/algoritmos.h"
+
+using namespace std;
+
+/**
+ * @brief Función principal que mide la multiplicación por lotes de matrices pequeñas (4x4 a 32x32).
+ *
+ * Los lotes se generan al cargar cada grupo, así que no necesita archivos de datos.
+ *
+ * @return int Código de estado de la ejecución.
+ */
+int main(int argc, char* argv[]) {
+    RegistroBenchmark registro;
+    agregarMultiplicacionPorLotes(registro);
+
+    return ejecutarBenchmark(registro, argc, argv);
+}
@@ -0,0 +1,19 @@
+#include <iostream>
+#include <vector>
+#include "transpuesta.h"
+#include "../Benchmark/benchmark.h"
+#include "../Benchmark/algoritmos.h"
+
+using namespace std;
+
+/**
+ * @brief Función principal que mide las transpuestas (ingenua, recursiva por teselas y en sitio) sobre los casos de matrices.
+ *
+ * @return int Código de estado de la ejecución.
+ */
+int main(int argc, char* argv[]) {
+    RegistroBenchmark registro;
+    agregarTranspuestas(registro, casosMatrices());
+
+    return ejecutarBenchmark(registro, argc, argv);
+}
@@ -0,0 +1,390 @@
+#ifndef CADENA_H
+#define CADENA_H
+
+#include <vector>
+#include <string>
+#include <memory>
+#include <chrono>
+#include <limits>
+#include <ostream>
+#include <algorithm>
+#include "matrices.h"
+
+/**
+ * @brief Multiplicador usado para cada producto de una cadena.
+ */
+enum NucleoProducto {
+    NUCLEO_AUTOMATICO,  // Elegido por elegirNucleo según la forma de cada producto
+    NUCLEO_TRADICIONAL,
+    NUCLEO_OPTIMIZADO,
+    NUCLEO_STRASSEN,
+    NUCLEO_BLOQUES
+};
+
+inline const char* nombreNucleo(NucleoProducto nucleo) {
+    switch (nucleo) {
+    case NUCLEO_TRADICIONAL:
+        return "Tradicional";
+    case NUCLEO_OPTIMIZADO:
+        return "Optimizada";
+    case NUCLEO_STRASSEN:
+        return "Strassen";
+    case NUCLEO_BLOQUES:
+        return "Bloques";
+    default:
+        return "Automático";
+    }
+}
+
+const int DIMENSION_TRADICIONAL = 8;  // Con todas las dimensiones hasta aquí no compensa preparar nada
+const int COLUMNAS_OPTIMIZADO = 16;   // Resultados más estrechos: productos punto sobre B transpuesta
+const int DIMENSION_STRASSEN = 4096;  // Cuadradas desde este tamaño: Strassen ahorra más de lo que cuesta
+
+/**
+ * @brief Elige el multiplicador más rápido para un producto (filas x comun)·(comun x columnas).
+ *
+ * Umbrales medidos con el benchmark: la multiplicación por bloques es la más rápida salvo
+ * en productos diminutos, en resultados muy estrechos (donde sus filas de C son demasiado
+ * cortas para vectorizar) y en cuadradas muy grandes, donde gana la menor complejidad de Strassen.
+ */
+inline NucleoProducto elegirNucleo(int filas, int comun, int columnas) {
+    if (filas <= DIMENSION_TRADICIONAL && comun <= DIMENSION_TRADICIONAL && columnas <= DIMENSION_TRADICIONAL) {
+        return NUCLEO_TRADICIONAL;
+    }
+    if (filas == comun && comun == columnas && filas >= DIMENSION_STRASSEN) {
+        return NUCLEO_STRASSEN;
+    }
+    if (columnas < COLUMNAS_OPTIMIZADO) {
+        return NUCLEO_OPTIMIZADO;
+    }
+    return NUCLEO_BLOQUES;
+}
+
+/**
+ * @brief Operaciones de Strassen sobre una matriz cuadrada de tamaño n, con el mismo relleno que strassenCuadrado.
+ *
+ * F(t) = 2t³ si t <= UMBRAL; si no, 7·F(t/2) más 18 sumas o restas de (t/2)² elementos.
+ */
+inline double flopsStrassenCuadrado(int n) {
+    int divisiones = 0;
+    while (((n + (1 << divisiones) - 1) >> divisiones) > UMBRAL) {
+        divisiones++;
+    }
+    double tamano = static_cast<double>(((n + (1 << divisiones) - 1) >> divisiones));
+    double flops = 2.0 * tamano * tamano * tamano;
+    for (int d = 0; d < divisiones; d++) {
+        flops = 7 * flops + 18 * tamano * tamano;
+        tamano *= 2;
+    }
+    return flops;
+}
+
+/**
+ * @brief Operaciones que hace un multiplicador en un producto (filas x comun)·(comun x columnas).
+ *
+ * Son 2·m·k·n salvo con Strassen, que hace menos productos pero más sumas, y que con
+ * matrices rectangulares trabaja sobre bloques cuadrados rellenos (ver strassenMultiplicacion).
+ */
+inline double flopsNucleo(NucleoProducto nucleo, int filas, int comun, int columnas) {
+    if (nucleo != NUCLEO_STRASSEN) {
+        return 2.0 * filas * comun * columnas;
+    }
+    if (filas == comun && comun == columnas) {
+        return flopsStrassenCuadrado(filas);
+    }
+    int bloque = std::min(filas, std::min(comun, columnas));
+    if (bloque == 0) {
+        return 0;
+    }
+    double bloquesFilas = (filas + bloque - 1) / bloque;
+    double bloquesComun = (comun + bloque - 1) / bloque;
+    double bloquesColumnas = (columnas + bloque - 1) / bloque;
+    return bloquesFilas * bloquesColumnas * (bloquesComun * flopsStrassenCuadrado(bloque) + bloquesComun * bloque * bloque);
+}
+
+/**
+ * @brief Orden de evaluación de una cadena A1·A2·...·An.
+ */
+struct PlanCadena {
+    std::vector<int> dimensiones;             // La matriz i es dimensiones[i] x dimensiones[i + 1]
+    std::vector<std::vector<int>> division;   // division[i][j]: último factor de la izquierda en el producto i..j
+    double flops = 0;                         // Flops previstos: 2·m·k·n por producto
+
+    int cantidad() const {
+        return static_cast<int>(dimensiones.size()) - 1;
+    }
+};
+
+/**
+ * @brief Paréntesis óptimos por programación dinámica en O(n³).
+ *
+ * costo[i][j] es el mínimo de costo[i][k] + costo[k+1][j] + 2·d[i]·d[k+1]·d[j+1] sobre
+ * los cortes k. Para cadenas de decenas de matrices basta de sobra; el algoritmo
+ * O(n log n) de Hu–Shing sólo compensa con miles de factores.
+ *
+ * @param dimensiones n + 1 dimensiones de una cadena de n matrices.
+ * @return PlanCadena Plan con el mínimo número de flops.
+ */
+inline PlanCadena planificarCadena(const std::vector<int>& dimensiones) {
+    PlanCadena plan;
+    plan.dimensiones = dimensiones;
+    int n = plan.cantidad();
+    if (n <= 0) {
+        return plan;
+    }
+
+    std::vector<std::vector<double>> costo(n, std::vector<double>(n, 0));
+    plan.division.assign(n, std::vector<int>(n, 0));
+
+    for (int longitud = 2; longitud <= n; longitud++) {
+        for (int i = 0; i + longitud - 1 < n; i++) {
+            int j = i + longitud - 1;
+            costo[i][j] = std::numeric_limits<double>::infinity();
+            for (int k = i; k < j; k++) {
+                double candidato = costo[i][k] + costo[k + 1][j] + 2.0 * dimensiones[i] * dimensiones[k + 1] * dimensiones[j + 1];
+                if (candidato < costo[i][j]) {
+                    costo[i][j] = candidato;
+                    plan.division[i][j] = k;
+                }
+            }
+        }
+    }
+
+    plan.flops = costo[0][n - 1];
+    return plan;
+}
+
+/**
+ * @brief Plan que multiplica de izquierda a derecha, ((A1·A2)·A3)·..., como referencia.
+ */
+inline PlanCadena planIzquierdaADerecha(const std::vector<int>& dimensiones) {
+    PlanCadena plan;
+    plan.dimensiones = dimensiones;
+    int n = plan.cantidad();
+    if (n <= 0) {
+        return plan;
+    }
+
+    plan.division.assign(n, std::vector<int>(n, 0));
+    for (int i = 0; i < n; i++) {
+        for (int j = i + 1; j < n; j++) {
+            plan.division[i][j] = j - 1;
+        }
+    }
+    for (int j = 1; j < n; j++) {
+        plan.flops += 2.0 * dimensiones[0] * dimensiones[j] * dimensiones[j + 1];
+    }
+    return plan;
+}
+
+/**
+ * @brief Paréntesis del producto i..j de un plan, p. ej. "((A1·A2)·A3)".
+ */
+inline std::string parentesisCadena(const PlanCadena& plan, int i, int j) {
+    if (i == j) {
+        return "A" + std::to_string(i + 1);
+    }
+    int k = plan.division[i][j];
+    return "(" + parentesisCadena(plan, i, k) + "·" + parentesisCadena(plan, k + 1, j) + ")";
+}
+
+inline std::string parentesisCadena(const PlanCadena& plan) {
+    return plan.cantidad() > 0 ? parentesisCadena(plan, 0, plan.cantidad() - 1) : "";
+}
+
+/**
+ * @brief Un producto ejecutado de una cadena.
+ */
+struct ProductoCadena {
+    std::string expresion;
+    int filas = 0;
+    int comun = 0;
+    int columnas = 0;
+    NucleoProducto nucleo = NUCLEO_AUTOMATICO;
+    double flopsPrevistos = 0;  // 2·m·k·n, lo que cuenta el plan
+    double flopsReales = 0;     // Lo que hace el multiplicador elegido
+    double milisegundos = 0;
+};
+
+/**
+ * @brief Informe de la ejecución de una cadena: previsto frente a real, por producto y en total.
+ */
+struct InformeCadena {
+    std::string parentesis;
+    double flopsPrevistos = 0;
+    double flopsReales = 0;
+    double milisegundos = 0;
+    int buffersCreados = 0;  // Matrices intermedias reservadas (el resto reutiliza una anterior; Strassen siempre reserva)
+    std::vector<ProductoCadena> productos;
+};
+
+/**
+ * @brief Ejecuta un plan de cadena eligiendo un multiplicador por producto y reutilizando los intermedios.
+ */
+template <class T>
+class EjecutorCadena {
+public:
+    using Matriz = std::vector<std::vector<T>>;
+
+    EjecutorCadena(const std::vector<Matriz>& matrices, const PlanCadena& plan, NucleoProducto nucleo, InformeCadena* informe)
+        : matrices(matrices), plan(plan), nucleo(nucleo), informe(informe) {}
+
+    Matriz ejecutar() {
+        int n = plan.cantidad();
+        if (n <= 0 || static_cast<int>(matrices.size()) != n) {
+            return Matriz();
+        }
+        if (informe) {
+            *informe = InformeCadena();
+            informe->parentesis = parentesisCadena(plan);
+        }
+        if (n == 1) {
+            return matrices[0];
+        }
+
+        auto inicio = std::chrono::steady_clock::now();
+        std::unique_ptr<Matriz> resultado = producto(0, n - 1);
+        auto fin = std::chrono::steady_clock::now();
+        if (informe) {
+            informe->milisegundos = std::chrono::duration<double, std::milli>(fin - inicio).count();
+        }
+        return std::move(*resultado);
+    }
+
+private:
+    const std::vector<Matriz>& matrices;
+    const PlanCadena& plan;
+    NucleoProducto nucleo;
+    InformeCadena* informe;
+    std::vector<std::unique_ptr<Matriz>> libres;  // Intermedios ya consumidos, listos para reutilizarse
+
+    // Las matrices de entrada se usan directamente; los subproductos quedan en 'propio'
+    const Matriz& operando(int i, int j, std::unique_ptr<Matriz>& propio) {
+        if (i == j) {
+            return matrices[i];
+        }
+        propio = producto(i, j);
+        return *propio;
+    }
+
+    // Con 'reutilizar' en false (núcleos que devuelven una matriz nueva) se reserva siempre
+    std::unique_ptr<Matriz> tomarBuffer(bool reutilizar) {
+        if (!reutilizar || libres.empty()) {
+            if (informe) {
+                informe->buffersCreados++;
+            }
+            return std::unique_ptr<Matriz>(new Matriz());
+        }
+        std::unique_ptr<Matriz> buffer = std::move(libres.back());
+        libres.pop_back();
+        return buffer;
+    }
+
+    void devolverBuffer(std::unique_ptr<Matriz>& buffer) {
+        if (buffer) {
+            libres.push_back(std::move(buffer));
+        }
+    }
+
+    std::unique_ptr<Matriz> producto(int i, int j) {
+        int k = plan.division[i][j];
+        std::unique_ptr<Matriz> propioA, propioB;
+        const Matriz& A = operando(i, k, propioA);
+        const Matriz& B = operando(k + 1, j, propioB);
+
+        int filas = plan.dimensiones[i];
+        int comun = plan.dimensiones[k + 1];
+        int columnas = plan.dimensiones[j + 1];
+        NucleoProducto elegido = nucleo == NUCLEO_AUTOMATICO ? elegirNucleo(filas, comun, columnas) : nucleo;
+
+        // Strassen construye su resultado con sus propios intermedios: no aprovecharía un buffer
+        std::unique_ptr<Matriz> C = tomarBuffer(elegido != NUCLEO_STRASSEN);
+        auto inicio = std::chrono::steady_clock::now();
+        // Las versiones ...En escriben sobre la memoria del intermedio reutilizado
+        switch (elegido) {
+        case NUCLEO_TRADICIONAL:
+            multiplicarMatricesEn(A, B, filas, comun, columnas, *C);
+            break;
+        case NUCLEO_OPTIMIZADO:
+            multiplicarMatricesOptimizadoEn(A, B, filas, comun, columnas, *C);
+            break;
+        case NUCLEO_STRASSEN:
+            *C = strassenMultiplicacion(A, B);
+            break;
+        default:
+            multiplicarMatricesBloquesEn(A, B, *C);
+            break;
+        }
+        auto fin = std::chrono::steady_clock::now();
+
+        if (informe) {
+            ProductoCadena registro;
+            registro.expresion = parentesisCadena(plan, i, j);
+            registro.filas = filas;
+            registro.comun = comun;
+            registro.columnas = columnas;
+            registro.nucleo = elegido;
+            registro.flopsPrevistos = 2.0 * filas * comun * columnas;
+            registro.flopsReales = flopsNucleo(elegido, filas, comun, columnas);
+            registro.milisegundos = std::chrono::duration<double, std::milli>(fin - inicio).count();
+            informe->flopsPrevistos += registro.flopsPrevistos;
+            informe->flopsReales += registro.flopsReales;
+            informe->productos.push_back(registro);
+        }
+
+        devolverBuffer(propioA);
+        devolverBuffer(propioB);
+        return C;
+    }
+};
+
+/**
+ * @brief Multiplica una cadena de matrices siguiendo un plan.
+ *
+ * @param matrices Factores A1..An; la matriz i debe ser dimensiones[i] x dimensiones[i + 1].
+ * @param plan Plan de planificarCadena (o planIzquierdaADerecha).
+ * @param nucleo Multiplicador de todos los productos, o NUCLEO_AUTOMATICO para elegirlo en cada uno.
+ * @param informe Si no es nullptr, recibe los flops previstos y reales y el tiempo de cada producto.
+ * @return std::vector<std::vector<T>> Producto de la cadena (vacío si el plan no corresponde).
+ */
+template <class T>
+std::vector<std::vector<T>> ejecutarCadena(const std::vector<std::vector<std::vector<T>>>& matrices, const PlanCadena& plan,
+                                           NucleoProducto nucleo = NUCLEO_AUTOMATICO, InformeCadena* informe = nullptr) {
+    return EjecutorCadena<T>(matrices, plan, nucleo, informe).ejecutar();
+}
+
+/**
+ * @brief Dimensiones de una lista de matrices como cadena (vacío si dos factores consecutivos no encajan).
+ */
+template <class T>
+std::vector<int> dimensionesCadena(const std::vector<std::vector<std::vector<T>>>& matrices) {
+    std::vector<int> dimensiones;
+    for (size_t i = 0; i < matrices.size(); i++) {
+        int filas = matrices[i].size();
+        int columnas = matrices[i].empty() ? 0 : matrices[i][0].size();
+        if (i == 0) {
+            dimensiones.push_back(filas);
+        } else if (dimensiones.back() != filas) {
+            return std::vector<int>();
+        }
+        dimensiones.push_back(columnas);
+    }
+    return dimensiones;
+}
+
+/**
+ * @brief Escribe un informe de cadena legible: plan, multiplicador de cada producto y previsto frente a real.
+ */
+inline void imprimirInformeCadena(std::ostream& salida, const InformeCadena& informe) {
+    salida << "Plan: " << informe.parentesis << std::endl;
+    for (const ProductoCadena& producto : informe.productos) {
+        salida << "  " << producto.expresion << ": " << producto.filas << "x" << producto.comun << " · "
+               << producto.comun << "x" << producto.columnas << " [" << nombreNucleo(producto.nucleo) << "] - "
+               << producto.flopsPrevistos / 1e9 << " GFLOP previstos, " << producto.flopsReales / 1e9
+               << " reales, " << producto.milisegundos << " ms" << std::endl;
+    }
+    salida << "Total: " << informe.flopsPrevistos / 1e9 << " GFLOP previstos, " << informe.flopsReales / 1e9
+           << " reales, " << informe.milisegundos << " ms, " << informe.buffersCreados << " matrices intermedias reservadas" << std::endl;
+}
+
+#endif
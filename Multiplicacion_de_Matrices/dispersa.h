@@ -0,0 +1,515 @@
+#ifndef DISPERSA_H
+#define DISPERSA_H
+
+#include <vector>
+#include <string>
+#include <fstream>
+#include <iostream>
+#include <algorithm>
+#include <thread>
+#include <cstdint>
+
+/**
+ * @brief Matriz dispersa en formato CSR (filas comprimidas).
+ *
+ * Los elementos no nulos de la fila i ocupan las posiciones [inicioFila[i], inicioFila[i + 1])
+ * de 'columna' y 'valores', con las columnas en orden creciente.
+ */
+template <class T>
+struct MatrizCSR {
+    int filas = 0;
+    int columnas = 0;
+    std::vector<int> inicioFila;  // filas + 1 posiciones
+    std::vector<int> columna;
+    std::vector<T> valores;
+
+    size_t noNulos() const {
+        return valores.size();
+    }
+};
+
+/**
+ * @brief Matriz dispersa en formato CSC (columnas comprimidas), con las filas en orden creciente.
+ */
+template <class T>
+struct MatrizCSC {
+    int filas = 0;
+    int columnas = 0;
+    std::vector<int> inicioColumna;  // columnas + 1 posiciones
+    std::vector<int> fila;
+    std::vector<T> valores;
+
+    size_t noNulos() const {
+        return valores.size();
+    }
+};
+
+/**
+ * @brief Convierte una matriz densa a CSR.
+ *
+ * @param M Matriz densa.
+ * @return MatrizCSR<T> Matriz con sólo los elementos distintos de cero.
+ */
+template <class T>
+MatrizCSR<T> csrDesdeDensa(const std::vector<std::vector<T>>& M) {
+    MatrizCSR<T> resultado;
+    resultado.filas = M.size();
+    resultado.columnas = M.empty() ? 0 : M[0].size();
+    resultado.inicioFila.reserve(resultado.filas + 1);
+    resultado.inicioFila.push_back(0);
+
+    for (const auto& fila : M) {
+        for (int j = 0; j < resultado.columnas; j++) {
+            if (fila[j] != T()) {
+                resultado.columna.push_back(j);
+                resultado.valores.push_back(fila[j]);
+            }
+        }
+        resultado.inicioFila.push_back(resultado.valores.size());
+    }
+
+    return resultado;
+}
+
+/**
+ * @brief Convierte una matriz densa a CSC.
+ */
+template <class T>
+MatrizCSC<T> cscDesdeDensa(const std::vector<std::vector<T>>& M) {
+    MatrizCSC<T> resultado;
+    resultado.filas = M.size();
+    resultado.columnas = M.empty() ? 0 : M[0].size();
+    resultado.inicioColumna.reserve(resultado.columnas + 1);
+    resultado.inicioColumna.push_back(0);
+
+    for (int j = 0; j < resultado.columnas; j++) {
+        for (int i = 0; i < resultado.filas; i++) {
+            if (M[i][j] != T()) {
+                resultado.fila.push_back(i);
+                resultado.valores.push_back(M[i][j]);
+            }
+        }
+        resultado.inicioColumna.push_back(resultado.valores.size());
+    }
+
+    return resultado;
+}
+
+/**
+ * @brief Expande una matriz CSR a formato denso.
+ */
+template <class T>
+std::vector<std::vector<T>> densaDesdeCsr(const MatrizCSR<T>& A) {
+    std::vector<std::vector<T>> M(A.filas, std::vector<T>(A.columnas, T()));
+    for (int i = 0; i < A.filas; i++) {
+        for (int p = A.inicioFila[i]; p < A.inicioFila[i + 1]; p++) {
+            M[i][A.columna[p]] = A.valores[p];
+        }
+    }
+    return M;
+}
+
+/**
+ * @brief Convierte CSR a CSC en O(filas + columnas + noNulos) mediante un conteo por columnas.
+ *
+ * Al recorrer las filas en orden, cada columna de salida queda con sus filas ordenadas.
+ */
+template <class T>
+MatrizCSC<T> cscDesdeCsr(const MatrizCSR<T>& A) {
+    MatrizCSC<T> resultado;
+    resultado.filas = A.filas;
+    resultado.columnas = A.columnas;
+    resultado.inicioColumna.assign(A.columnas + 1, 0);
+    resultado.fila.resize(A.noNulos());
+    resultado.valores.resize(A.noNulos());
+
+    // Contar los elementos de cada columna y acumular
+    for (int j : A.columna) {
+        resultado.inicioColumna[j + 1]++;
+    }
+    for (int j = 0; j < A.columnas; j++) {
+        resultado.inicioColumna[j + 1] += resultado.inicioColumna[j];
+    }
+
+    // Repartir cada elemento en su columna
+    std::vector<int> siguiente(resultado.inicioColumna.begin(), resultado.inicioColumna.end() - 1);
+    for (int i = 0; i < A.filas; i++) {
+        for (int p = A.inicioFila[i]; p < A.inicioFila[i + 1]; p++) {
+            int destino = siguiente[A.columna[p]]++;
+            resultado.fila[destino] = i;
+            resultado.valores[destino] = A.valores[p];
+        }
+    }
+
+    return resultado;
+}
+
+/**
+ * @brief Convierte CSC a CSR (la operación simétrica de cscDesdeCsr).
+ */
+template <class T>
+MatrizCSR<T> csrDesdeCsc(const MatrizCSC<T>& A) {
+    // Una CSC es la CSR de la transpuesta: se reutiliza la conversión intercambiando los papeles
+    MatrizCSR<T> transpuesta;
+    transpuesta.filas = A.columnas;
+    transpuesta.columnas = A.filas;
+    transpuesta.inicioFila = A.inicioColumna;
+    transpuesta.columna = A.fila;
+    transpuesta.valores = A.valores;
+
+    MatrizCSC<T> intermedia = cscDesdeCsr(transpuesta);
+    MatrizCSR<T> resultado;
+    resultado.filas = A.filas;
+    resultado.columnas = A.columnas;
+    resultado.inicioFila = std::move(intermedia.inicioColumna);
+    resultado.columna = std::move(intermedia.fila);
+    resultado.valores = std::move(intermedia.valores);
+    return resultado;
+}
+
+/**
+ * @brief Lee una matriz del formato de texto de los datasets directamente en CSR.
+ *
+ * No construye la matriz densa: sólo guarda los valores distintos de cero.
+ *
+ * @param nombreArchivo Nombre del archivo que contiene la matriz.
+ * @param filas Número de filas de la matriz.
+ * @param columnas Número de columnas de la matriz.
+ * @return MatrizCSR<int> Matriz leída (vacía si no se pudo abrir el archivo).
+ */
+inline MatrizCSR<int> leerMatrizDispersaDesdeArchivo(const std::string& nombreArchivo, int filas, int columnas) {
+    MatrizCSR<int> resultado;
+    std::ifstream archivo(nombreArchivo);
+
+    if (!archivo.is_open()) {
+        std::cerr << "Error al abrir el archivo: " << nombreArchivo << std::endl;
+        return resultado;
+    }
+
+    resultado.filas = filas;
+    resultado.columnas = columnas;
+    resultado.inicioFila.reserve(filas + 1);
+    resultado.inicioFila.push_back(0);
+    for (int i = 0; i < filas; i++) {
+        for (int j = 0; j < columnas; j++) {
+            int valor = 0;
+            archivo >> valor;
+            if (valor != 0) {
+                resultado.columna.push_back(j);
+                resultado.valores.push_back(valor);
+            }
+        }
+        resultado.inicioFila.push_back(resultado.valores.size());
+    }
+
+    archivo.close();
+    return resultado;
+}
+
+/**
+ * @brief Producto dispersa x densa (SpMM): C = A·B con A en CSR.
+ *
+ * Cada elemento no nulo A[i][k] suma A[i][k]·B[k][:] a la fila i de C, de modo que
+ * el trabajo es 2·noNulos(A)·columnasB en vez de 2·filasA·columnasA·columnasB.
+ *
+ * @param A Primera matriz (m x k) en CSR.
+ * @param B Segunda matriz densa (k x n).
+ * @return std::vector<std::vector<T>> Matriz resultante densa (m x n).
+ */
+template <class T>
+std::vector<std::vector<T>> multiplicarDispersaDensa(const MatrizCSR<T>& A, const std::vector<std::vector<T>>& B) {
+    int columnasB = B.empty() ? 0 : B[0].size();
+    std::vector<std::vector<T>> C(A.filas, std::vector<T>(columnasB, T()));
+
+    for (int i = 0; i < A.filas; i++) {
+        T* filaC = C[i].data();
+        for (int p = A.inicioFila[i]; p < A.inicioFila[i + 1]; p++) {
+            T valor = A.valores[p];
+            const T* filaB = B[A.columna[p]].data();
+            for (int j = 0; j < columnasB; j++) {
+                filaC[j] += valor * filaB[j];
+            }
+        }
+    }
+
+    return C;
+}
+
+/**
+ * @brief Producto densa x dispersa: C = A·B con B en CSC.
+ *
+ * C[i][j] es el producto de la fila i de A por los elementos no nulos de la columna j de B.
+ */
+template <class T>
+std::vector<std::vector<T>> multiplicarDensaDispersa(const std::vector<std::vector<T>>& A, const MatrizCSC<T>& B) {
+    std::vector<std::vector<T>> C(A.size(), std::vector<T>(B.columnas, T()));
+
+    for (size_t i = 0; i < A.size(); i++) {
+        const T* filaA = A[i].data();
+        for (int j = 0; j < B.columnas; j++) {
+            T suma = T();
+            for (int p = B.inicioColumna[j]; p < B.inicioColumna[j + 1]; p++) {
+                suma += filaA[B.fila[p]] * B.valores[p];
+            }
+            C[i][j] = suma;
+        }
+    }
+
+    return C;
+}
+
+/**
+ * @brief Acumulador denso para una fila de SpGEMM: un valor y una marca por columna.
+ *
+ * Ocupa O(columnas) memoria pero cada suma es un acceso directo; se reutiliza entre
+ * filas reiniciando sólo las columnas tocadas.
+ */
+template <class T>
+class AcumuladorDenso {
+public:
+    explicit AcumuladorDenso(int columnas) : valores(columnas, T()), usada(columnas, false) {}
+
+    void sumar(int columna, T valor) {
+        if (!usada[columna]) {
+            usada[columna] = true;
+            tocadas.push_back(columna);
+        }
+        valores[columna] += valor;
+    }
+
+    /**
+     * @brief Agrega la fila acumulada (columnas ordenadas) al final de la salida y se reinicia.
+     */
+    void volcar(std::vector<int>& columnas, std::vector<T>& salida) {
+        std::sort(tocadas.begin(), tocadas.end());
+        for (int j : tocadas) {
+            columnas.push_back(j);
+            salida.push_back(valores[j]);
+            valores[j] = T();
+            usada[j] = false;
+        }
+        tocadas.clear();
+    }
+
+private:
+    std::vector<T> valores;
+    std::vector<char> usada;
+    std::vector<int> tocadas;
+};
+
+/**
+ * @brief Acumulador con tabla hash para una fila de SpGEMM (direccionamiento abierto, sondeo lineal).
+ *
+ * La tabla se dimensiona con la cota superior de elementos de la fila (sus productos),
+ * así que ocupa memoria proporcional al trabajo de la fila y no al ancho de la matriz.
+ */
+template <class T>
+class AcumuladorHash {
+public:
+    /**
+     * @brief Prepara la tabla para a lo sumo 'maximo' columnas distintas.
+     */
+    void reiniciar(size_t maximo) {
+        size_t capacidad = 16;
+        while (capacidad < 2 * maximo) {
+            capacidad *= 2;
+        }
+        mascara = capacidad - 1;
+        claves.assign(capacidad, -1);
+        valores.assign(capacidad, T());
+    }
+
+    void sumar(int columna, T valor) {
+        size_t posicion = (static_cast<uint32_t>(columna) * 2654435761u) & mascara;
+        while (claves[posicion] != -1 && claves[posicion] != columna) {
+            posicion = (posicion + 1) & mascara;
+        }
+        claves[posicion] = columna;
+        valores[posicion] += valor;
+    }
+
+    /**
+     * @brief Agrega la fila acumulada (columnas ordenadas) al final de la salida.
+     */
+    void volcar(std::vector<int>& columnas, std::vector<T>& salida) {
+        size_t inicio = columnas.size();
+        for (size_t posicion = 0; posicion < claves.size(); posicion++) {
+            if (claves[posicion] != -1) {
+                columnas.push_back(claves[posicion]);
+            }
+        }
+        std::sort(columnas.begin() + inicio, columnas.end());
+        for (size_t p = inicio; p < columnas.size(); p++) {
+            salida.push_back(valores[buscar(columnas[p])]);
+        }
+    }
+
+private:
+    std::vector<int> claves;
+    std::vector<T> valores;
+    size_t mascara = 0;
+
+    size_t buscar(int columna) const {
+        size_t posicion = (static_cast<uint32_t>(columna) * 2654435761u) & mascara;
+        while (claves[posicion] != columna) {
+            posicion = (posicion + 1) & mascara;
+        }
+        return posicion;
+    }
+};
+
+/**
+ * @brief Número de productos (cota de elementos no nulos) de cada fila de A·B.
+ */
+template <class T>
+std::vector<size_t> productosPorFila(const MatrizCSR<T>& A, const MatrizCSR<T>& B) {
+    std::vector<size_t> productos(A.filas, 0);
+    for (int i = 0; i < A.filas; i++) {
+        for (int p = A.inicioFila[i]; p < A.inicioFila[i + 1]; p++) {
+            int k = A.columna[p];
+            productos[i] += B.inicioFila[k + 1] - B.inicioFila[k];
+        }
+    }
+    return productos;
+}
+
+/**
+ * @brief Algoritmo de Gustavson para las filas [primera, ultima) de A·B.
+ *
+ * La fila i de C es la combinación de las filas de B indicadas por la fila i de A:
+ * C[i][:] = suma sobre k de A[i][k]·B[k][:]. El resultado se agrega al final de
+ * 'columnas' y 'valores', y 'finFila' recibe la posición final de cada fila.
+ */
+template <class T, class Acumulador>
+void gustavsonFilas(const MatrizCSR<T>& A, const MatrizCSR<T>& B, int primera, int ultima, Acumulador& acumulador,
+                    std::vector<int>& columnas, std::vector<T>& valores, std::vector<int>& finFila) {
+    for (int i = primera; i < ultima; i++) {
+        for (int p = A.inicioFila[i]; p < A.inicioFila[i + 1]; p++) {
+            int k = A.columna[p];
+            T valor = A.valores[p];
+            for (int q = B.inicioFila[k]; q < B.inicioFila[k + 1]; q++) {
+                acumulador.sumar(B.columna[q], valor * B.valores[q]);
+            }
+        }
+        acumulador.volcar(columnas, valores);
+        finFila.push_back(columnas.size());
+    }
+}
+
+/**
+ * @brief Producto dispersa x dispersa (SpGEMM) de Gustavson con acumulador denso.
+ *
+ * @param A Primera matriz (m x k) en CSR.
+ * @param B Segunda matriz (k x n) en CSR.
+ * @return MatrizCSR<T> Matriz resultante (m x n) en CSR.
+ */
+template <class T>
+MatrizCSR<T> spgemmDenso(const MatrizCSR<T>& A, const MatrizCSR<T>& B) {
+    MatrizCSR<T> C;
+    C.filas = A.filas;
+    C.columnas = B.columnas;
+    C.inicioFila.reserve(A.filas + 1);
+    C.inicioFila.push_back(0);
+
+    AcumuladorDenso<T> acumulador(B.columnas);
+    gustavsonFilas(A, B, 0, A.filas, acumulador, C.columna, C.valores, C.inicioFila);
+    return C;
+}
+
+/**
+ * @brief Producto dispersa x dispersa (SpGEMM) de Gustavson con acumulador hash.
+ *
+ * Preferible al denso cuando las filas del resultado son muy cortas frente al ancho
+ * de la matriz, porque la tabla de cada fila cabe en la caché.
+ */
+template <class T>
+MatrizCSR<T> spgemmHash(const MatrizCSR<T>& A, const MatrizCSR<T>& B) {
+    MatrizCSR<T> C;
+    C.filas = A.filas;
+    C.columnas = B.columnas;
+    C.inicioFila.reserve(A.filas + 1);
+    C.inicioFila.push_back(0);
+
+    std::vector<size_t> productos = productosPorFila(A, B);
+    AcumuladorHash<T> acumulador;
+    for (int i = 0; i < A.filas; i++) {
+        acumulador.reiniciar(std::min<size_t>(productos[i], B.columnas));
+        gustavsonFilas(A, B, i, i + 1, acumulador, C.columna, C.valores, C.inicioFila);
+    }
+    return C;
+}
+
+/**
+ * @brief SpGEMM de Gustavson en paralelo, repartiendo bloques de filas entre hilos.
+ *
+ * Los bloques se eligen para que cada hilo haga aproximadamente el mismo número de
+ * productos (no de filas). Cada hilo calcula sus filas en vectores propios con un
+ * acumulador denso, y al final se concatenan en orden.
+ *
+ * @param A Primera matriz (m x k) en CSR.
+ * @param B Segunda matriz (k x n) en CSR.
+ * @param hilos Número de hilos (0: los que indique el hardware).
+ * @return MatrizCSR<T> Matriz resultante (m x n) en CSR.
+ */
+template <class T>
+MatrizCSR<T> spgemmParalelo(const MatrizCSR<T>& A, const MatrizCSR<T>& B, int hilos = 0) {
+    if (hilos <= 0) {
+        hilos = std::max(1u, std::thread::hardware_concurrency());
+    }
+    hilos = std::max(1, std::min(hilos, A.filas));
+
+    // Cortes de filas con trabajo equilibrado
+    std::vector<size_t> productos = productosPorFila(A, B);
+    size_t total = 0;
+    for (size_t cantidad : productos) {
+        total += cantidad;
+    }
+    std::vector<int> cortes(1, 0);
+    size_t acumulado = 0;
+    for (int i = 0; i < A.filas && static_cast<int>(cortes.size()) < hilos; i++) {
+        acumulado += productos[i];
+        if (acumulado * hilos >= total * cortes.size()) {
+            cortes.push_back(i + 1);
+        }
+    }
+    if (cortes.back() != A.filas) {
+        cortes.push_back(A.filas);
+    }
+    int bloques = cortes.size() - 1;
+
+    std::vector<std::vector<int>> columnas(bloques), finFila(bloques);
+    std::vector<std::vector<T>> valores(bloques);
+    auto calcular = [&](int b) {
+        AcumuladorDenso<T> acumulador(B.columnas);
+        gustavsonFilas(A, B, cortes[b], cortes[b + 1], acumulador, columnas[b], valores[b], finFila[b]);
+    };
+
+    std::vector<std::thread> trabajadores;
+    for (int b = 1; b < bloques; b++) {
+        trabajadores.emplace_back(calcular, b);
+    }
+    if (bloques > 0) {
+        calcular(0);
+    }
+    for (std::thread& trabajador : trabajadores) {
+        trabajador.join();
+    }
+
+    // Concatenar los bloques, desplazando los finales de fila de cada uno
+    MatrizCSR<T> C;
+    C.filas = A.filas;
+    C.columnas = B.columnas;
+    C.inicioFila.reserve(A.filas + 1);
+    C.inicioFila.push_back(0);
+    for (int b = 0; b < bloques; b++) {
+        int desplazamiento = C.columna.size();
+        for (int fin : finFila[b]) {
+            C.inicioFila.push_back(desplazamiento + fin);
+        }
+        C.columna.insert(C.columna.end(), columnas[b].begin(), columnas[b].end());
+        C.valores.insert(C.valores.end(), valores[b].begin(), valores[b].end());
+    }
+    return C;
+}
+
+#endif
@@ -0,0 +1,499 @@
+#ifndef FUERA_DE_MEMORIA_H
+#define FUERA_DE_MEMORIA_H
+
+#include <vector>
+#include <string>
+#include <fstream>
+#include <ostream>
+#include <algorithm>
+#include <thread>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <cstdio>
+
+// Multiplicación de matrices guardadas en archivos binarios que no necesitan caber en
+// memoria: se recorren teselas de A y B dentro de un presupuesto de bytes, se carga la
+// siguiente pareja en otro hilo mientras se multiplica la actual y cada tesela de C se
+// escribe en cuanto está completa.
+//
+// Formato binario: una cabecera de 24 bytes ("MATB", bytes por elemento, filas y columnas
+// como enteros de 64 bits) seguida de los elementos por filas, en el orden de bytes de la
+// máquina que lo escribe.
+
+const int COLUMNAS_PASO_FUERA = 256;   // Ancho de las franjas de C acumuladas en un arreglo local
+const int FILAS_PASO_FUERA = 4;        // Filas de C actualizadas a la vez
+const int INTERIOR_MINIMO_FUERA = 32;  // Mínimo de columnas de A (filas de B) por tesela
+
+/**
+ * @brief Cabecera de un archivo de matriz binaria.
+ */
+struct CabeceraMatrizBinaria {
+    char firma[4] = {'M', 'A', 'T', 'B'};
+    uint32_t bytesElemento = 0;
+    int64_t filas = 0;
+    int64_t columnas = 0;
+};
+
+static_assert(sizeof(CabeceraMatrizBinaria) == 24, "La cabecera binaria debe ocupar 24 bytes sin relleno");
+
+/**
+ * @brief Lee y valida la cabecera de un archivo binario.
+ *
+ * @return bool false si el archivo no existe o no tiene una cabecera válida.
+ */
+inline bool leerCabeceraBinaria(const std::string& nombreArchivo, CabeceraMatrizBinaria& cabecera) {
+    std::ifstream archivo(nombreArchivo, std::ios::binary);
+    if (!archivo.read(reinterpret_cast<char*>(&cabecera), sizeof(cabecera))) {
+        return false;
+    }
+    return std::memcmp(cabecera.firma, "MATB", 4) == 0 && cabecera.filas >= 0 && cabecera.columnas >= 0;
+}
+
+/**
+ * @brief Crea un archivo binario de filas x columnas con la cabecera escrita y los datos sin inicializar.
+ *
+ * El archivo se extiende hasta su tamaño final con una sola escritura del último byte.
+ */
+template <class T>
+bool crearMatrizBinaria(const std::string& nombreArchivo, int64_t filas, int64_t columnas) {
+    CabeceraMatrizBinaria cabecera;
+    cabecera.bytesElemento = sizeof(T);
+    cabecera.filas = filas;
+    cabecera.columnas = columnas;
+
+    std::ofstream archivo(nombreArchivo, std::ios::binary | std::ios::trunc);
+    archivo.write(reinterpret_cast<const char*>(&cabecera), sizeof(cabecera));
+    int64_t bytesDatos = filas * columnas * static_cast<int64_t>(sizeof(T));
+    if (bytesDatos > 0) {
+        archivo.seekp(sizeof(cabecera) + bytesDatos - 1);
+        archivo.put(0);
+    }
+    return static_cast<bool>(archivo);
+}
+
+/**
+ * @brief Escribe una matriz en memoria en el formato binario.
+ */
+template <class T>
+bool escribirMatrizBinaria(const std::string& nombreArchivo, const std::vector<std::vector<T>>& M) {
+    CabeceraMatrizBinaria cabecera;
+    cabecera.bytesElemento = sizeof(T);
+    cabecera.filas = M.size();
+    cabecera.columnas = M.empty() ? 0 : M[0].size();
+
+    std::ofstream archivo(nombreArchivo, std::ios::binary | std::ios::trunc);
+    archivo.write(reinterpret_cast<const char*>(&cabecera), sizeof(cabecera));
+    for (const auto& fila : M) {
+        archivo.write(reinterpret_cast<const char*>(fila.data()), fila.size() * sizeof(T));
+    }
+    return static_cast<bool>(archivo);
+}
+
+/**
+ * @brief Lee por completo una matriz binaria (para matrices que sí caben en memoria).
+ *
+ * @return std::vector<std::vector<T>> La matriz, o una matriz vacía si el archivo no es válido o su tipo no es T.
+ */
+template <class T>
+std::vector<std::vector<T>> leerMatrizBinaria(const std::string& nombreArchivo) {
+    CabeceraMatrizBinaria cabecera;
+    if (!leerCabeceraBinaria(nombreArchivo, cabecera) || cabecera.bytesElemento != sizeof(T)) {
+        return {};
+    }
+    std::ifstream archivo(nombreArchivo, std::ios::binary);
+    archivo.seekg(sizeof(cabecera));
+    std::vector<std::vector<T>> M(cabecera.filas, std::vector<T>(cabecera.columnas));
+    for (auto& fila : M) {
+        archivo.read(reinterpret_cast<char*>(fila.data()), fila.size() * sizeof(T));
+    }
+    if (!archivo) {
+        return {};
+    }
+    return M;
+}
+
+/**
+ * @brief Convierte un archivo de texto de los datasets a binario fila a fila, sin cargarlo entero.
+ *
+ * Se escribe en archivoBinario + ".tmp" y se renombra al terminar, así que si el texto
+ * falta o está incompleto no queda ningún binario a medias con el nombre definitivo.
+ *
+ * @param archivoTexto Archivo con filas x columnas valores separados por espacios.
+ * @param archivoBinario Archivo binario de salida.
+ * @return bool false si falta algún valor o no se pudo escribir.
+ */
+template <class T>
+bool convertirTextoABinario(const std::string& archivoTexto, const std::string& archivoBinario, int64_t filas, int64_t columnas) {
+    std::ifstream entrada(archivoTexto);
+    if (!entrada) {
+        return false;
+    }
+    CabeceraMatrizBinaria cabecera;
+    cabecera.bytesElemento = sizeof(T);
+    cabecera.filas = filas;
+    cabecera.columnas = columnas;
+
+    std::string temporal = archivoBinario + ".tmp";
+    bool completo = true;
+    {
+        std::ofstream salida(temporal, std::ios::binary | std::ios::trunc);
+        salida.write(reinterpret_cast<const char*>(&cabecera), sizeof(cabecera));
+        std::vector<T> fila(columnas);
+        for (int64_t i = 0; i < filas && completo; i++) {
+            for (int64_t j = 0; j < columnas; j++) {
+                entrada >> fila[j];
+            }
+            completo = static_cast<bool>(entrada);
+            if (completo) {
+                salida.write(reinterpret_cast<const char*>(fila.data()), columnas * sizeof(T));
+            }
+        }
+        salida.close();
+        completo = completo && static_cast<bool>(salida);
+    }
+    if (!completo || std::rename(temporal.c_str(), archivoBinario.c_str()) != 0) {
+        std::remove(temporal.c_str());
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Tamaños de tesela elegidos para un presupuesto de memoria.
+ */
+struct PlanFueraDeMemoria {
+    int filasTesela = 0;      // Filas de las teselas de A y C
+    int columnasTesela = 0;   // Columnas de las teselas de B y C
+    int interiorTesela = 0;   // Columnas de A y filas de B por tesela
+    size_t bytes = 0;         // Memoria de la tesela de C más dos juegos de teselas de A y B
+};
+
+/**
+ * @brief Bytes que ocupan la tesela de C y las teselas de A y B actuales y siguientes.
+ */
+template <class T>
+size_t bytesPlanFueraDeMemoria(int filas, int interior, int columnas) {
+    size_t elementos = static_cast<size_t>(filas) * columnas + 2 * (static_cast<size_t>(filas) * interior + static_cast<size_t>(interior) * columnas);
+    return elementos * sizeof(T);
+}
+
+/**
+ * @brief Elige las teselas para C (m x n) = A (m x k) · B (k x n) dentro de 'presupuesto' bytes.
+ *
+ * Cada tesela de C se calcula entera en memoria, así que A se lee n / columnasTesela veces y
+ * B m / filasTesela veces: conviene la tesela de C más grande posible. Se parte de un lado
+ * que deja la mitad del presupuesto a C, y el resto se da al interior de las dos parejas de
+ * teselas de A y B (como mínimo INTERIOR_MINIMO_FUERA; si no llega, se reduce el lado).
+ *
+ * @return PlanFueraDeMemoria Plan con filasTesela = 0 si ni siquiera cabe una tesela de 1x1.
+ */
+template <class T>
+PlanFueraDeMemoria planificarFueraDeMemoria(int m, int k, int n, size_t presupuesto) {
+    PlanFueraDeMemoria plan;
+    if (bytesPlanFueraDeMemoria<T>(1, 1, 1) > presupuesto || m <= 0 || k <= 0 || n <= 0) {
+        return plan;
+    }
+
+    size_t elementos = presupuesto / sizeof(T);
+    int lado = std::max(1, static_cast<int>(std::sqrt(elementos / 2.0)));
+    while (true) {
+        int filas = std::min(m, lado);
+        // Si A tiene pocas filas, el espacio sobrante se da a las columnas de C
+        int columnas = std::min<int64_t>(n, std::max<int64_t>(lado, static_cast<int64_t>(lado) * lado / filas));
+        size_t ocupados = static_cast<size_t>(filas) * columnas;
+        int64_t interior = ocupados < elementos ? (elementos - ocupados) / (2 * (static_cast<size_t>(filas) + columnas)) : 0;
+        interior = std::min<int64_t>(k, interior);
+        if (interior >= std::min(k, INTERIOR_MINIMO_FUERA) || (lado == 1 && interior >= 1)) {
+            plan.filasTesela = filas;
+            plan.columnasTesela = columnas;
+            plan.interiorTesela = interior;
+            plan.bytes = bytesPlanFueraDeMemoria<T>(filas, interior, columnas);
+            return plan;
+        }
+        if (lado == 1) {
+            return plan;
+        }
+        lado = std::max(1, lado * 7 / 8);
+    }
+}
+
+/**
+ * @brief Resumen de una multiplicación fuera de memoria.
+ */
+struct InformeFueraDeMemoria {
+    PlanFueraDeMemoria plan;
+    long long teselasCargadas = 0;     // Teselas de A y B leídas del disco
+    long long teselasReutilizadas = 0; // Teselas de A y B que ya estaban en memoria al pasar de una tesela de C a otra
+    long long bytesLeidos = 0;
+    long long bytesEscritos = 0;
+    double segundosEspera = 0;         // Tiempo esperando al hilo de carga después de multiplicar
+    double segundosTotales = 0;
+};
+
+/**
+ * @brief Imprime el plan y los contadores de E/S de una multiplicación fuera de memoria.
+ */
+inline void imprimirInformeFueraDeMemoria(std::ostream& salida, const InformeFueraDeMemoria& informe) {
+    const PlanFueraDeMemoria& plan = informe.plan;
+    salida << "  Teselas: A " << plan.filasTesela << "x" << plan.interiorTesela << ", B " << plan.interiorTesela << "x" << plan.columnasTesela
+           << ", C " << plan.filasTesela << "x" << plan.columnasTesela << " (" << plan.bytes / 1024.0 << " KiB en memoria)\n";
+    salida << "  Teselas leídas: " << informe.teselasCargadas << ", reutilizadas: " << informe.teselasReutilizadas
+           << " - " << informe.bytesLeidos / 1048576.0 << " MiB leídos, " << informe.bytesEscritos / 1048576.0 << " MiB escritos\n";
+    salida << "  Tiempo: " << informe.segundosTotales * 1000 << " ms, esperando lecturas: " << informe.segundosEspera * 1000 << " ms\n";
+}
+
+/**
+ * @brief Tesela de una matriz binaria cargada en memoria, guardada por filas.
+ */
+template <class T>
+struct TeselaArchivo {
+    int fila = -1;
+    int columna = -1;
+    int filas = 0;
+    int columnas = 0;
+    std::vector<T> datos;
+};
+
+/**
+ * @brief Lee la tesela [fila, fila + filas) x [columna, columna + columnas) de un archivo binario abierto.
+ *
+ * Si la tesela ocupa filas completas se lee con una sola llamada.
+ */
+template <class T>
+bool leerTeselaBinaria(std::ifstream& archivo, const CabeceraMatrizBinaria& cabecera, int fila, int columna, int filas, int columnas, TeselaArchivo<T>& tesela) {
+    tesela.fila = fila;
+    tesela.columna = columna;
+    tesela.filas = filas;
+    tesela.columnas = columnas;
+    tesela.datos.resize(static_cast<size_t>(filas) * columnas);
+
+    auto desplazamiento = [&](int64_t i) {
+        return static_cast<std::streamoff>(sizeof(cabecera) + (i * cabecera.columnas + columna) * static_cast<int64_t>(sizeof(T)));
+    };
+    if (columnas == cabecera.columnas) {
+        archivo.seekg(desplazamiento(fila));
+        archivo.read(reinterpret_cast<char*>(tesela.datos.data()), tesela.datos.size() * sizeof(T));
+    } else {
+        for (int r = 0; r < filas; r++) {
+            archivo.seekg(desplazamiento(fila + r));
+            archivo.read(reinterpret_cast<char*>(tesela.datos.data() + static_cast<size_t>(r) * columnas), columnas * sizeof(T));
+        }
+    }
+    return static_cast<bool>(archivo);
+}
+
+/**
+ * @brief Escribe una tesela de C (guardada por filas) en su posición del archivo binario.
+ */
+template <class T>
+bool escribirTeselaBinaria(std::fstream& archivo, const CabeceraMatrizBinaria& cabecera, int fila, int columna, int filas, int columnas, const T* datos) {
+    for (int r = 0; r < filas; r++) {
+        int64_t posicion = sizeof(cabecera) + ((fila + r) * cabecera.columnas + columna) * static_cast<int64_t>(sizeof(T));
+        archivo.seekp(static_cast<std::streamoff>(posicion));
+        archivo.write(reinterpret_cast<const char*>(datos + static_cast<size_t>(r) * columnas), columnas * sizeof(T));
+    }
+    return static_cast<bool>(archivo);
+}
+
+/**
+ * @brief C[i..][jj..] += A[i..][..] · B[..][jj..] para FILAS filas y una franja de columnas de las teselas.
+ *
+ * Mismo esquema que actualizarBloque, sobre teselas contiguas: las filas de C se acumulan
+ * en un arreglo local y, con ANCHO > 0, el ancho de la franja es constante.
+ */
+template <int FILAS, int ANCHO, class T>
+void acumularFranjaTesela(const T* A, const T* B, T* C, int i, int interior, int columnas, int jj, int ancho) {
+    const int n = ANCHO > 0 ? ANCHO : ancho;
+    T local[FILAS][COLUMNAS_PASO_FUERA];
+
+    for (int r = 0; r < FILAS; r++) {
+        for (int j = 0; j < n; j++) {
+            local[r][j] = C[static_cast<size_t>(i + r) * columnas + jj + j];
+        }
+    }
+    for (int k = 0; k < interior; k++) {
+        const T* filaB = B + static_cast<size_t>(k) * columnas + jj;
+        T a[FILAS];
+        for (int r = 0; r < FILAS; r++) {
+            a[r] = A[static_cast<size_t>(i + r) * interior + k];
+        }
+        for (int j = 0; j < n; j++) {
+            T b = filaB[j];
+            for (int r = 0; r < FILAS; r++) {
+                local[r][j] += a[r] * b;
+            }
+        }
+    }
+    for (int r = 0; r < FILAS; r++) {
+        for (int j = 0; j < n; j++) {
+            C[static_cast<size_t>(i + r) * columnas + jj + j] = local[r][j];
+        }
+    }
+}
+
+/**
+ * @brief C += A · B sobre teselas contiguas: A (filas x interior), B (interior x columnas), C (filas x columnas).
+ */
+template <class T>
+void acumularProductoTeselas(const T* A, const T* B, T* C, int filas, int interior, int columnas) {
+    for (int jj = 0; jj < columnas; jj += COLUMNAS_PASO_FUERA) {
+        int ancho = std::min(COLUMNAS_PASO_FUERA, columnas - jj);
+        bool completo = ancho == COLUMNAS_PASO_FUERA;
+        int i = 0;
+        for (; i + FILAS_PASO_FUERA <= filas; i += FILAS_PASO_FUERA) {
+            if (completo) {
+                acumularFranjaTesela<FILAS_PASO_FUERA, COLUMNAS_PASO_FUERA>(A, B, C, i, interior, columnas, jj, ancho);
+            } else {
+                acumularFranjaTesela<FILAS_PASO_FUERA, 0>(A, B, C, i, interior, columnas, jj, ancho);
+            }
+        }
+        for (; i < filas; i++) {
+            acumularFranjaTesela<1, 0>(A, B, C, i, interior, columnas, jj, ancho);
+        }
+    }
+}
+
+/**
+ * @brief Multiplica dos matrices binarias sin cargarlas enteras: C = A · B dentro de 'presupuesto' bytes.
+ *
+ * Orden de las lecturas: las teselas de C se recorren en zigzag (de izquierda a derecha en
+ * una fila de teselas y de derecha a izquierda en la siguiente) y el índice interior
+ * alterna de sentido de una tesela de C a la siguiente. Así la última tesela de A (o de B)
+ * de una tesela de C es la primera de la siguiente y no se vuelve a leer.
+ *
+ * Mientras se multiplica una pareja de teselas, otro hilo lee la siguiente en un segundo
+ * juego de búferes; cada tesela de C se escribe en cuanto se completa su suma.
+ *
+ * @param archivoA Archivo binario de A (m x k).
+ * @param archivoB Archivo binario de B (k x n).
+ * @param archivoC Archivo binario de salida para C (m x n); se sobrescribe.
+ * @param presupuesto Bytes máximos para las teselas en memoria.
+ * @param informe Si no es nulo, recibe el plan y los contadores de E/S.
+ * @return bool false si los archivos no son válidos, sus dimensiones o tipos no encajan, el presupuesto no alcanza o falla la E/S.
+ */
+template <class T>
+bool multiplicarFueraDeMemoria(const std::string& archivoA, const std::string& archivoB, const std::string& archivoC, size_t presupuesto,
+                               InformeFueraDeMemoria* informe = nullptr) {
+    auto inicio = std::chrono::steady_clock::now();
+    CabeceraMatrizBinaria cabeceraA, cabeceraB;
+    if (!leerCabeceraBinaria(archivoA, cabeceraA) || !leerCabeceraBinaria(archivoB, cabeceraB) ||
+        cabeceraA.bytesElemento != sizeof(T) || cabeceraB.bytesElemento != sizeof(T) || cabeceraA.columnas != cabeceraB.filas) {
+        return false;
+    }
+    int m = cabeceraA.filas;
+    int k = cabeceraA.columnas;
+    int n = cabeceraB.columnas;
+
+    PlanFueraDeMemoria plan = planificarFueraDeMemoria<T>(m, k, n, presupuesto);
+    if (plan.filasTesela == 0 || !crearMatrizBinaria<T>(archivoC, m, n)) {
+        return false;
+    }
+    CabeceraMatrizBinaria cabeceraC;
+    cabeceraC.bytesElemento = sizeof(T);
+    cabeceraC.filas = m;
+    cabeceraC.columnas = n;
+
+    // Lista de pasos (tesela de C, índice interior) en el orden descrito arriba
+    struct Paso {
+        int fila, columna, interior;
+        bool primero, ultimo;
+    };
+    std::vector<Paso> pasos;
+    int filasTeselas = (m + plan.filasTesela - 1) / plan.filasTesela;
+    int columnasTeselas = (n + plan.columnasTesela - 1) / plan.columnasTesela;
+    int interiorTeselas = (k + plan.interiorTesela - 1) / plan.interiorTesela;
+    int teselaC = 0;
+    for (int ti = 0; ti < filasTeselas; ti++) {
+        for (int c = 0; c < columnasTeselas; c++, teselaC++) {
+            int tj = ti % 2 == 0 ? c : columnasTeselas - 1 - c;
+            for (int p = 0; p < interiorTeselas; p++) {
+                int tk = teselaC % 2 == 0 ? p : interiorTeselas - 1 - p;
+                pasos.push_back({ti * plan.filasTesela, tj * plan.columnasTesela, tk * plan.interiorTesela, p == 0, p == interiorTeselas - 1});
+            }
+        }
+    }
+
+    std::ifstream entradaA(archivoA, std::ios::binary);
+    std::ifstream entradaB(archivoB, std::ios::binary);
+    std::fstream salida(archivoC, std::ios::binary | std::ios::in | std::ios::out);
+    TeselaArchivo<T> actualA, actualB, siguienteA, siguienteB;
+    std::vector<T> teselaDeC;
+    InformeFueraDeMemoria resultado;
+    resultado.plan = plan;
+    bool correcto = true;
+
+    // Carga (o reutiliza) las teselas de A y B de un paso; se ejecuta en el hilo de carga
+    auto cargar = [&](const Paso& paso, TeselaArchivo<T>& destinoA, TeselaArchivo<T>& destinoB, bool& cargadaA, bool& cargadaB, bool& ok) {
+        int filas = std::min(plan.filasTesela, m - paso.fila);
+        int interior = std::min(plan.interiorTesela, k - paso.interior);
+        int columnas = std::min(plan.columnasTesela, n - paso.columna);
+        cargadaA = actualA.fila != paso.fila || actualA.columna != paso.interior;
+        cargadaB = actualB.fila != paso.interior || actualB.columna != paso.columna;
+        ok = true;
+        if (cargadaA) {
+            ok = leerTeselaBinaria(entradaA, cabeceraA, paso.fila, paso.interior, filas, interior, destinoA) && ok;
+        }
+        if (cargadaB) {
+            ok = leerTeselaBinaria(entradaB, cabeceraB, paso.interior, paso.columna, interior, columnas, destinoB) && ok;
+        }
+    };
+    auto contar = [&](bool cargadaA, bool cargadaB) {
+        resultado.teselasCargadas += cargadaA + cargadaB;
+        resultado.teselasReutilizadas += !cargadaA + !cargadaB;
+        resultado.bytesLeidos += (cargadaA ? siguienteA.datos.size() : 0) * sizeof(T) + (cargadaB ? siguienteB.datos.size() : 0) * sizeof(T);
+    };
+
+    bool cargadaA, cargadaB, ok;
+    cargar(pasos[0], siguienteA, siguienteB, cargadaA, cargadaB, ok);
+    contar(cargadaA, cargadaB);
+    std::swap(actualA, siguienteA);
+    std::swap(actualB, siguienteB);
+    correcto = ok;
+
+    for (size_t p = 0; p < pasos.size() && correcto; p++) {
+        const Paso& paso = pasos[p];
+        bool siguienteCargadaA = false, siguienteCargadaB = false, siguienteOk = true;
+        std::thread cargador;
+        if (p + 1 < pasos.size()) {
+            cargador = std::thread(cargar, std::cref(pasos[p + 1]), std::ref(siguienteA), std::ref(siguienteB),
+                                   std::ref(siguienteCargadaA), std::ref(siguienteCargadaB), std::ref(siguienteOk));
+        }
+
+        int filas = std::min(plan.filasTesela, m - paso.fila);
+        int columnas = std::min(plan.columnasTesela, n - paso.columna);
+        if (paso.primero) {
+            teselaDeC.assign(static_cast<size_t>(filas) * columnas, T());
+        }
+        acumularProductoTeselas(actualA.datos.data(), actualB.datos.data(), teselaDeC.data(), filas, actualA.columnas, columnas);
+        if (paso.ultimo) {
+            correcto = escribirTeselaBinaria(salida, cabeceraC, paso.fila, paso.columna, filas, columnas, teselaDeC.data()) && correcto;
+            resultado.bytesEscritos += teselaDeC.size() * sizeof(T);
+        }
+
+        if (cargador.joinable()) {
+            auto antesDeEsperar = std::chrono::steady_clock::now();
+            cargador.join();
+            resultado.segundosEspera += std::chrono::duration<double>(std::chrono::steady_clock::now() - antesDeEsperar).count();
+            contar(siguienteCargadaA, siguienteCargadaB);
+            if (siguienteCargadaA) {
+                std::swap(actualA, siguienteA);
+            }
+            if (siguienteCargadaB) {
+                std::swap(actualB, siguienteB);
+            }
+            correcto = correcto && siguienteOk;
+        }
+    }
+
+    salida.flush();
+    correcto = correcto && static_cast<bool>(salida);
+    resultado.segundosTotales = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+    if (informe) {
+        *informe = resultado;
+    }
+    return correcto;
+}
+
+#endif
@@ -0,0 +1,323 @@
+#ifndef GEMM_ESTRECHO_H
+#define GEMM_ESTRECHO_H
+
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include "matrices.h"
+#include "../Ordenamiento/argmin.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+/**
+ * @brief Tipo de elemento más estrecho con el que un producto se calcula sin perder exactitud.
+ */
+enum TipoEstrecho {
+    ESTRECHO_INT8,    // A en uint8 y B en int8, cuatro productos por instrucción
+    ESTRECHO_INT16,   // A y B en int16, dos productos por instrucción
+    ESTRECHO_NINGUNO  // Los valores no caben: se usa el multiplicador general
+};
+
+/**
+ * @brief Nombre del tipo elegido, para mostrarlo en los resultados.
+ */
+inline const char* nombreTipoEstrecho(TipoEstrecho tipo) {
+    switch (tipo) {
+    case ESTRECHO_INT8:
+        return "int8";
+    case ESTRECHO_INT16:
+        return "int16";
+    default:
+        return "int32";
+    }
+}
+
+const int COLUMNAS_PANEL = 16;  // Columnas de B por panel (dos registros de 8 acumuladores int32)
+const int FILAS_MICRO = 4;      // Filas de A que comparten cada carga del panel
+
+#if defined(__AVXVNNI__) || (defined(__AVX512VNNI__) && defined(__AVX512VL__))
+const bool PRODUCTO_PUNTO_INT8 = true;   // VPDPBUSD: u8·s8, suma de 4 productos sin saturar
+#else
+const bool PRODUCTO_PUNTO_INT8 = false;  // VPMADDUBSW satura la suma de cada par en int16
+#endif
+
+/**
+ * @brief Valores mínimo y máximo de una matriz (0 y 0 si está vacía).
+ */
+inline void rangoMatriz(const std::vector<std::vector<int>>& M, long long& minimo, long long& maximo) {
+    minimo = 0;
+    maximo = 0;
+    bool primero = true;
+    for (const auto& fila : M) {
+        int minimoFila, maximoFila;
+        if (!minimoMaximo(fila.data(), fila.size(), minimoFila, maximoFila)) {
+            continue;
+        }
+        if (primero || minimoFila < minimo) {
+            minimo = minimoFila;
+        }
+        if (primero || maximoFila > maximo) {
+            maximo = maximoFila;
+        }
+        primero = false;
+    }
+}
+
+/**
+ * @brief Elige el tipo más estrecho que representa A y B y cuyo producto no desborda.
+ *
+ * Además de que los valores quepan, la suma de columnasA productos debe caber en el
+ * acumulador int32; con int8 sin VNNI, la suma de dos productos debe caber en int16.
+ * Si A tiene valores negativos no se puede usar int8, porque las instrucciones de
+ * producto con bytes tratan el primer operando como sin signo.
+ *
+ * @param A Primera matriz (m x k).
+ * @param B Segunda matriz (k x n).
+ * @return TipoEstrecho Tipo elegido.
+ */
+inline TipoEstrecho elegirTipoEstrecho(const std::vector<std::vector<int>>& A, const std::vector<std::vector<int>>& B) {
+    long long minA, maxA, minB, maxB;
+    rangoMatriz(A, minA, maxA);
+    rangoMatriz(B, minB, maxB);
+    long long magnitudA = std::max(-minA, maxA);
+    long long magnitudB = std::max(-minB, maxB);
+    long long k = B.size();
+
+    // k · |A| · |B| <= INT32_MAX, comprobado sin desbordar
+    if (magnitudA > 0 && magnitudB > INT32_MAX / magnitudA) {
+        return ESTRECHO_NINGUNO;
+    }
+    long long producto = magnitudA * magnitudB;
+    if (k > 0 && producto > INT32_MAX / k) {
+        return ESTRECHO_NINGUNO;
+    }
+
+    if (minA >= 0 && maxA <= UINT8_MAX && minB >= INT8_MIN && maxB <= INT8_MAX &&
+        (PRODUCTO_PUNTO_INT8 || 2 * producto <= INT16_MAX)) {
+        return ESTRECHO_INT8;
+    }
+    // Se excluye -32768: dos productos (-32768)·(-32768) no caben en int32
+    if (minA > INT16_MIN && maxA <= INT16_MAX && minB > INT16_MIN && maxB <= INT16_MAX) {
+        return ESTRECHO_INT16;
+    }
+    return ESTRECHO_NINGUNO;
+}
+
+/**
+ * @brief Copia A en filas contiguas de longitud kRelleno, completadas con ceros.
+ */
+template <class T>
+std::vector<T> empaquetarFilas(const std::vector<std::vector<int>>& A, int kRelleno) {
+    std::vector<T> datos(A.size() * kRelleno, 0);
+    for (size_t i = 0; i < A.size(); i++) {
+        for (size_t k = 0; k < A[i].size(); k++) {
+            datos[i * kRelleno + k] = static_cast<T>(A[i][k]);
+        }
+    }
+    return datos;
+}
+
+/**
+ * @brief Reordena B en paneles de COLUMNAS_PANEL columnas para los productos ensanchados.
+ *
+ * Dentro de cada panel, para cada grupo de G filas de B, se guardan juntas las G
+ * entradas de cada columna: así un registro contiene, para 8 columnas, justo los G
+ * valores que se multiplican por los G valores consecutivos de una fila de A.
+ *
+ * @param B Matriz (k x n).
+ * @param grupos Número de grupos de G filas (k redondeado hacia arriba).
+ * @return std::vector<T> Paneles consecutivos, rellenos con ceros.
+ */
+template <class T, int G>
+std::vector<T> empaquetarPaneles(const std::vector<std::vector<int>>& B, int grupos) {
+    int filas = B.size();
+    int columnas = B.empty() ? 0 : B[0].size();
+    int paneles = (columnas + COLUMNAS_PANEL - 1) / COLUMNAS_PANEL;
+    std::vector<T> datos(static_cast<size_t>(paneles) * grupos * COLUMNAS_PANEL * G, 0);
+
+    for (int fila = 0; fila < filas; fila++) {
+        int g = fila / G;
+        int e = fila % G;
+        for (int columna = 0; columna < columnas; columna++) {
+            int p = columna / COLUMNAS_PANEL;
+            int c = columna % COLUMNAS_PANEL;
+            datos[((static_cast<size_t>(p) * grupos + g) * COLUMNAS_PANEL + c) * G + e] = static_cast<T>(B[fila][columna]);
+        }
+    }
+
+    return datos;
+}
+
+#if defined(__AVX2__)
+/**
+ * @brief acumulador += suma por grupos de dos productos int16 (VPMADDWD).
+ */
+inline __m256i productoSumaEnsanchado(__m256i acumulador, __m256i a, __m256i b, int16_t) {
+    return _mm256_add_epi32(acumulador, _mm256_madd_epi16(a, b));
+}
+
+/**
+ * @brief acumulador += suma por grupos de cuatro productos u8·s8 (VPDPBUSD si hay VNNI).
+ */
+inline __m256i productoSumaEnsanchado(__m256i acumulador, __m256i a, __m256i b, int8_t) {
+#if defined(__AVXVNNI__)
+    return _mm256_dpbusd_avx_epi32(acumulador, a, b);
+#elif defined(__AVX512VNNI__) && defined(__AVX512VL__)
+    return _mm256_dpbusd_epi32(acumulador, a, b);
+#else
+    // Pares u8·s8 a int16 y luego pares de int16 a int32
+    __m256i pares = _mm256_maddubs_epi16(a, b);
+    return _mm256_add_epi32(acumulador, _mm256_madd_epi16(pares, _mm256_set1_epi16(1)));
+#endif
+}
+#endif
+
+/**
+ * @brief Micro-núcleo: FILAS filas de A por un panel de B, con acumuladores int32.
+ *
+ * Cada grupo de G elementos de A ocupa 32 bits (G·sizeof(TA) = 4) y se replica en
+ * todo el registro; el panel aporta los G valores correspondientes de 8 columnas.
+ *
+ * @param A Primera de las FILAS filas empaquetadas.
+ * @param kRelleno Longitud de cada fila empaquetada.
+ * @param panel Panel de B.
+ * @param grupos Grupos de G elementos por fila.
+ * @param salida Bloque de FILAS x COLUMNAS_PANEL resultados.
+ */
+template <int G, int FILAS, class TA, class TB>
+void microNucleoEstrecho(const TA* A, int kRelleno, const TB* panel, int grupos, int32_t* salida) {
+#if defined(__AVX2__)
+    __m256i acumuladores[FILAS][2];
+    for (int r = 0; r < FILAS; r++) {
+        acumuladores[r][0] = _mm256_setzero_si256();
+        acumuladores[r][1] = _mm256_setzero_si256();
+    }
+
+    for (int g = 0; g < grupos; g++) {
+        const TB* bloque = panel + static_cast<size_t>(g) * COLUMNAS_PANEL * G;
+        __m256i b0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bloque));
+        __m256i b1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bloque + 8 * G));
+        for (int r = 0; r < FILAS; r++) {
+            int32_t grupoA;
+            std::memcpy(&grupoA, A + static_cast<size_t>(r) * kRelleno + g * G, sizeof(grupoA));
+            __m256i a = _mm256_set1_epi32(grupoA);
+            acumuladores[r][0] = productoSumaEnsanchado(acumuladores[r][0], a, b0, TB());
+            acumuladores[r][1] = productoSumaEnsanchado(acumuladores[r][1], a, b1, TB());
+        }
+    }
+
+    for (int r = 0; r < FILAS; r++) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(salida + r * COLUMNAS_PANEL), acumuladores[r][0]);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(salida + r * COLUMNAS_PANEL + 8), acumuladores[r][1]);
+    }
+#else
+    // Sin AVX2: el mismo recorrido en escalar, que el compilador puede vectorizar
+    int32_t acumuladores[FILAS][COLUMNAS_PANEL] = {};
+    for (int g = 0; g < grupos; g++) {
+        const TB* bloque = panel + static_cast<size_t>(g) * COLUMNAS_PANEL * G;
+        for (int r = 0; r < FILAS; r++) {
+            const TA* grupoA = A + static_cast<size_t>(r) * kRelleno + g * G;
+            for (int c = 0; c < COLUMNAS_PANEL; c++) {
+                for (int e = 0; e < G; e++) {
+                    acumuladores[r][c] += static_cast<int32_t>(grupoA[e]) * static_cast<int32_t>(bloque[c * G + e]);
+                }
+            }
+        }
+    }
+
+    for (int r = 0; r < FILAS; r++) {
+        for (int c = 0; c < COLUMNAS_PANEL; c++) {
+            salida[r * COLUMNAS_PANEL + c] = acumuladores[r][c];
+        }
+    }
+#endif
+}
+
+/**
+ * @brief Producto con A en TA y B en TB, agrupando G elementos de k por instrucción.
+ *
+ * Recorre B panel a panel: cada panel (16 columnas de todas las filas) se lee desde la
+ * caché para todas las filas de A, de FILAS_MICRO en FILAS_MICRO.
+ *
+ * @param A Primera matriz (m x k); sus valores deben caber en TA.
+ * @param B Segunda matriz (k x n); sus valores deben caber en TB.
+ * @return std::vector<std::vector<int>> Matriz resultante (m x n).
+ */
+template <class TA, class TB, int G>
+std::vector<std::vector<int>> multiplicarEmpaquetado(const std::vector<std::vector<int>>& A, const std::vector<std::vector<int>>& B) {
+    static_assert(G * sizeof(TA) == 4 && G * sizeof(TB) == 4, "cada grupo debe ocupar 32 bits");
+
+    int filasA = A.size();
+    int columnasA = B.size();
+    int columnasB = B.empty() ? 0 : B[0].size();
+    std::vector<std::vector<int>> C(filasA, std::vector<int>(columnasB, 0));
+    if (filasA == 0 || columnasB == 0) {
+        return C;
+    }
+
+    int grupos = (columnasA + G - 1) / G;
+    int kRelleno = grupos * G;
+    std::vector<TA> a = empaquetarFilas<TA>(A, kRelleno);
+    std::vector<TB> b = empaquetarPaneles<TB, G>(B, grupos);
+
+    int paneles = (columnasB + COLUMNAS_PANEL - 1) / COLUMNAS_PANEL;
+    int32_t bloque[FILAS_MICRO * COLUMNAS_PANEL];
+
+    for (int p = 0; p < paneles; p++) {
+        const TB* panel = b.data() + static_cast<size_t>(p) * grupos * COLUMNAS_PANEL * G;
+        int primeraColumna = p * COLUMNAS_PANEL;
+        int columnas = std::min(COLUMNAS_PANEL, columnasB - primeraColumna);
+
+        int i = 0;
+        for (; i + FILAS_MICRO <= filasA; i += FILAS_MICRO) {
+            microNucleoEstrecho<G, FILAS_MICRO>(a.data() + static_cast<size_t>(i) * kRelleno, kRelleno, panel, grupos, bloque);
+            for (int r = 0; r < FILAS_MICRO; r++) {
+                std::copy(bloque + r * COLUMNAS_PANEL, bloque + r * COLUMNAS_PANEL + columnas, C[i + r].begin() + primeraColumna);
+            }
+        }
+        for (; i < filasA; i++) {
+            microNucleoEstrecho<G, 1>(a.data() + static_cast<size_t>(i) * kRelleno, kRelleno, panel, grupos, bloque);
+            std::copy(bloque, bloque + columnas, C[i].begin() + primeraColumna);
+        }
+    }
+
+    return C;
+}
+
+/**
+ * @brief Multiplica con el tipo indicado; si es ESTRECHO_NINGUNO usa el multiplicador optimizado.
+ *
+ * @param A Primera matriz (m x k).
+ * @param B Segunda matriz (k x n).
+ * @param tipo Tipo de los operandos; debe ser seguro para A y B (ver elegirTipoEstrecho).
+ * @return std::vector<std::vector<int>> Matriz resultante (m x n).
+ */
+inline std::vector<std::vector<int>> multiplicarMatricesEstrecho(const std::vector<std::vector<int>>& A, const std::vector<std::vector<int>>& B, TipoEstrecho tipo) {
+    switch (tipo) {
+    case ESTRECHO_INT8:
+        return multiplicarEmpaquetado<uint8_t, int8_t, 4>(A, B);
+    case ESTRECHO_INT16:
+        return multiplicarEmpaquetado<int16_t, int16_t, 2>(A, B);
+    default:
+        return multiplicarMatricesOptimizado(A, B, A.size(), B.size(), B.empty() ? 0 : B[0].size());
+    }
+}
+
+/**
+ * @brief Multiplica con el tipo más estrecho que admiten los valores de A y B.
+ *
+ * Los datasets generados (valores de 0 a 100) usan int8: un cuarto del ancho de banda
+ * de int y cuatro productos por instrucción, acumulados en int32.
+ *
+ * @param A Primera matriz (m x k).
+ * @param B Segunda matriz (k x n).
+ * @return std::vector<std::vector<int>> Matriz resultante (m x n).
+ */
+inline std::vector<std::vector<int>> multiplicarMatricesEstrecho(const std::vector<std::vector<int>>& A, const std::vector<std::vector<int>>& B) {
+    return multiplicarMatricesEstrecho(A, B, elegirTipoEstrecho(A, B));
+}
+
+#endif
@@ -0,0 +1,296 @@
+#ifndef LOTES_H
+#define LOTES_H
+
+#include <vector>
+#include <random>
+#include <thread>
+#include <algorithm>
+
+/**
+ * @brief Cómo se guardan en memoria las matrices de un lote.
+ */
+enum DisposicionLote {
+    LOTE_CONTIGUO,    // Cada matriz contigua por filas; la matriz b empieza en b·paso
+    LOTE_INTERCALADO  // El elemento (i, j) de todas las matrices es contiguo: (i·columnas + j)·paso + b
+};
+
+const int BLOQUE_LOTE = 64;      // Matrices que se multiplican a la vez (un acumulador por matriz)
+const int COLUMNAS_LOTE = 4;     // Columnas del resultado que se acumulan a la vez
+const int MAXIMO_EN_SITIO = 64;  // Elementos por matriz hasta los que un lote intercalado se usa sin copiarlo
+const int MINIMO_POR_HILO = 1024;  // Matrices por hilo por debajo de las cuales no compensa repartir
+
+/**
+ * @brief Vista (sin propiedad) de un lote de matrices de la misma forma.
+ *
+ * 'paso' es la distancia entre matrices consecutivas en LOTE_CONTIGUO (al menos
+ * filas·columnas) y la distancia entre elementos consecutivos de una matriz en
+ * LOTE_INTERCALADO (al menos cantidad).
+ */
+template <class T>
+struct VistaLote {
+    T* datos = nullptr;
+    int cantidad = 0;
+    int filas = 0;
+    int columnas = 0;
+    DisposicionLote disposicion = LOTE_CONTIGUO;
+    size_t paso = 0;
+
+    T& elemento(int b, int i, int j) const {
+        size_t posicion = static_cast<size_t>(i) * columnas + j;
+        return disposicion == LOTE_CONTIGUO ? datos[b * paso + posicion] : datos[posicion * paso + b];
+    }
+
+    /**
+     * @brief Vista de sólo lectura de los mismos datos.
+     */
+    VistaLote<const T> lectura() const {
+        VistaLote<const T> vista;
+        vista.datos = datos;
+        vista.cantidad = cantidad;
+        vista.filas = filas;
+        vista.columnas = columnas;
+        vista.disposicion = disposicion;
+        vista.paso = paso;
+        return vista;
+    }
+};
+
+/**
+ * @brief Crea una vista de lote; con paso 0 se usa el paso compacto de la disposición.
+ */
+template <class T>
+VistaLote<T> vistaLote(T* datos, int cantidad, int filas, int columnas, DisposicionLote disposicion, size_t paso = 0) {
+    VistaLote<T> vista;
+    vista.datos = datos;
+    vista.cantidad = cantidad;
+    vista.filas = filas;
+    vista.columnas = columnas;
+    vista.disposicion = disposicion;
+    if (paso == 0) {
+        paso = disposicion == LOTE_CONTIGUO ? static_cast<size_t>(filas) * columnas : cantidad;
+    }
+    vista.paso = paso;
+    return vista;
+}
+
+/**
+ * @brief Lote de matrices que es dueño de su memoria (con paso compacto).
+ */
+template <class T>
+struct LoteMatrices {
+    std::vector<T> datos;
+    int cantidad = 0;
+    int filas = 0;
+    int columnas = 0;
+    DisposicionLote disposicion = LOTE_CONTIGUO;
+
+    LoteMatrices() = default;
+    LoteMatrices(int cantidad, int filas, int columnas, DisposicionLote disposicion)
+        : datos(static_cast<size_t>(cantidad) * filas * columnas, T()), cantidad(cantidad), filas(filas), columnas(columnas), disposicion(disposicion) {}
+
+    VistaLote<T> vista() {
+        return vistaLote(datos.data(), cantidad, filas, columnas, disposicion);
+    }
+    VistaLote<const T> vista() const {
+        return vistaLote(datos.data(), cantidad, filas, columnas, disposicion);
+    }
+};
+
+/**
+ * @brief Genera un lote de matrices con valores aleatorios entre 0 y 100.
+ */
+inline LoteMatrices<int> generarLoteAleatorio(int cantidad, int filas, int columnas, DisposicionLote disposicion) {
+    LoteMatrices<int> lote(cantidad, filas, columnas, disposicion);
+    std::mt19937 generador(std::random_device{}());
+    std::uniform_int_distribution<> distribucion(0, 100);
+    for (int& valor : lote.datos) {
+        valor = distribucion(generador);
+    }
+    return lote;
+}
+
+/**
+ * @brief Multiplica un bloque de matrices intercaladas: C(b) = A(b)·B(b) para b en [0, ancho).
+ *
+ * El bucle interno recorre el lote, que es contiguo, de modo que cada operación
+ * vectorial hace el mismo paso de la multiplicación para varias matrices a la vez.
+ * Con ANCHO > 0 el número de matrices es constante y el compilador lo vectoriza
+ * sin bucle de resto; con ANCHO = 0 se usa 'ancho'.
+ */
+template <int ANCHO, class T>
+void bloqueIntercalado(const T* A, size_t pasoA, const T* B, size_t pasoB, T* C, size_t pasoC,
+                       int filas, int comun, int columnas, int ancho) {
+    const int n = ANCHO > 0 ? ANCHO : ancho;
+    T acumulador[COLUMNAS_LOTE][BLOQUE_LOTE];
+
+    for (int i = 0; i < filas; i++) {
+        // Cada elemento de A se carga una vez para COLUMNAS_LOTE columnas de B
+        for (int j0 = 0; j0 < columnas; j0 += COLUMNAS_LOTE) {
+            int cuantas = std::min(COLUMNAS_LOTE, columnas - j0);
+            for (int jj = 0; jj < cuantas; jj++) {
+                for (int b = 0; b < n; b++) {
+                    acumulador[jj][b] = T();
+                }
+            }
+            for (int k = 0; k < comun; k++) {
+                const T* a = A + (static_cast<size_t>(i) * comun + k) * pasoA;
+                for (int jj = 0; jj < cuantas; jj++) {
+                    const T* v = B + (static_cast<size_t>(k) * columnas + j0 + jj) * pasoB;
+                    for (int b = 0; b < n; b++) {
+                        acumulador[jj][b] += a[b] * v[b];
+                    }
+                }
+            }
+            for (int jj = 0; jj < cuantas; jj++) {
+                T* c = C + (static_cast<size_t>(i) * columnas + j0 + jj) * pasoC;
+                for (int b = 0; b < n; b++) {
+                    c[b] = acumulador[jj][b];
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Copia 'ancho' matrices a partir de la b0 en disposición intercalada con paso BLOQUE_LOTE.
+ */
+template <class T>
+void intercalarBloque(const VistaLote<const T>& lote, int b0, int ancho, T* destino) {
+    size_t elementos = static_cast<size_t>(lote.filas) * lote.columnas;
+    if (lote.disposicion == LOTE_INTERCALADO) {
+        for (size_t e = 0; e < elementos; e++) {
+            std::copy(lote.datos + e * lote.paso + b0, lote.datos + e * lote.paso + b0 + ancho, destino + e * BLOQUE_LOTE);
+        }
+        return;
+    }
+    for (int b = 0; b < ancho; b++) {
+        const T* matriz = lote.datos + (b0 + b) * lote.paso;
+        for (size_t e = 0; e < elementos; e++) {
+            destino[e * BLOQUE_LOTE + b] = matriz[e];
+        }
+    }
+}
+
+/**
+ * @brief Multiplica las matrices [primera, ultima) del lote, de BLOQUE_LOTE en BLOQUE_LOTE.
+ *
+ * Los bloques se copian a un área intercalada propia de paso BLOQUE_LOTE, salvo los de
+ * lotes intercalados de matrices pequeñas, que se usan en su lugar. Con matrices más
+ * grandes se copian igualmente: con el paso del lote (a menudo una potencia de dos)
+ * los muchos elementos de una misma matriz caerían en los mismos conjuntos de la caché.
+ */
+template <class T>
+void multiplicarRangoLote(const VistaLote<const T>& A, const VistaLote<const T>& B, const VistaLote<T>& C, int primera, int ultima) {
+    auto enSitio = [](DisposicionLote disposicion, int filas, int columnas) {
+        return disposicion == LOTE_INTERCALADO && filas * columnas <= MAXIMO_EN_SITIO;
+    };
+    bool sitioA = enSitio(A.disposicion, A.filas, A.columnas);
+    bool sitioB = enSitio(B.disposicion, B.filas, B.columnas);
+    bool sitioC = enSitio(C.disposicion, C.filas, C.columnas);
+
+    std::vector<T> areaA(sitioA ? 0 : static_cast<size_t>(A.filas) * A.columnas * BLOQUE_LOTE);
+    std::vector<T> areaB(sitioB ? 0 : static_cast<size_t>(B.filas) * B.columnas * BLOQUE_LOTE);
+    std::vector<T> areaC(sitioC ? 0 : static_cast<size_t>(C.filas) * C.columnas * BLOQUE_LOTE);
+    size_t elementosC = static_cast<size_t>(C.filas) * C.columnas;
+
+    for (int b0 = primera; b0 < ultima; b0 += BLOQUE_LOTE) {
+        int ancho = std::min(BLOQUE_LOTE, ultima - b0);
+
+        const T* a = A.datos + b0;
+        size_t pasoA = A.paso;
+        if (!sitioA) {
+            intercalarBloque(A, b0, ancho, areaA.data());
+            a = areaA.data();
+            pasoA = BLOQUE_LOTE;
+        }
+        const T* b = B.datos + b0;
+        size_t pasoB = B.paso;
+        if (!sitioB) {
+            intercalarBloque(B, b0, ancho, areaB.data());
+            b = areaB.data();
+            pasoB = BLOQUE_LOTE;
+        }
+        T* c = sitioC ? C.datos + b0 : areaC.data();
+        size_t pasoC = sitioC ? C.paso : BLOQUE_LOTE;
+
+        if (ancho == BLOQUE_LOTE) {
+            bloqueIntercalado<BLOQUE_LOTE>(a, pasoA, b, pasoB, c, pasoC, A.filas, A.columnas, B.columnas, ancho);
+        } else {
+            bloqueIntercalado<0>(a, pasoA, b, pasoB, c, pasoC, A.filas, A.columnas, B.columnas, ancho);
+        }
+
+        // Devolver el resultado a la disposición de C
+        if (sitioC) {
+            continue;
+        }
+        if (C.disposicion == LOTE_INTERCALADO) {
+            for (size_t e = 0; e < elementosC; e++) {
+                std::copy(areaC.data() + e * BLOQUE_LOTE, areaC.data() + e * BLOQUE_LOTE + ancho, C.datos + e * C.paso + b0);
+            }
+        } else {
+            for (int m = 0; m < ancho; m++) {
+                T* matriz = C.datos + (b0 + m) * C.paso;
+                for (size_t e = 0; e < elementosC; e++) {
+                    matriz[e] = areaC[e * BLOQUE_LOTE + m];
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Multiplica dos lotes de matrices: C(b) = A(b)·B(b) para cada b.
+ *
+ * Cada operando puede estar en disposición contigua (con cualquier paso) o intercalada.
+ * Se vectoriza a lo largo del lote y el lote se reparte entre hilos por bloques de
+ * matrices consecutivas.
+ *
+ * @param vistaA Lote de matrices filas x comun (del mismo tipo que C, constante o no).
+ * @param vistaB Lote de matrices comun x columnas.
+ * @param C Lote de resultados filas x columnas (ya reservado).
+ * @param hilos Número de hilos (0: los que indique el hardware).
+ * @return bool false si las formas o cantidades de los lotes no son compatibles.
+ */
+template <class TA, class TB, class T>
+bool multiplicarLote(const VistaLote<TA>& vistaA, const VistaLote<TB>& vistaB, const VistaLote<T>& C, int hilos = 0) {
+    VistaLote<const T> A = vistaA.lectura();
+    VistaLote<const T> B = vistaB.lectura();
+    if (A.cantidad != B.cantidad || A.cantidad != C.cantidad || A.columnas != B.filas ||
+        C.filas != A.filas || C.columnas != B.columnas) {
+        return false;
+    }
+
+    if (hilos <= 0) {
+        hilos = std::max(1u, std::thread::hardware_concurrency());
+    }
+    hilos = std::max(1, std::min(hilos, A.cantidad / MINIMO_POR_HILO));
+
+    // Rangos múltiplos de BLOQUE_LOTE para que sólo el último bloque quede incompleto
+    int bloques = (A.cantidad + BLOQUE_LOTE - 1) / BLOQUE_LOTE;
+    std::vector<std::thread> trabajadores;
+    for (int h = 1; h < hilos; h++) {
+        int primera = std::min(A.cantidad, static_cast<int>(static_cast<long long>(bloques) * h / hilos) * BLOQUE_LOTE);
+        int ultima = std::min(A.cantidad, static_cast<int>(static_cast<long long>(bloques) * (h + 1) / hilos) * BLOQUE_LOTE);
+        trabajadores.emplace_back([&A, &B, &C, primera, ultima]() { multiplicarRangoLote(A, B, C, primera, ultima); });
+    }
+    multiplicarRangoLote(A, B, C, 0, std::min(A.cantidad, bloques / hilos * BLOQUE_LOTE));
+    for (std::thread& trabajador : trabajadores) {
+        trabajador.join();
+    }
+
+    return true;
+}
+
+/**
+ * @brief Multiplica dos lotes con dueño y devuelve el lote resultante en la disposición de A.
+ */
+template <class T>
+LoteMatrices<T> multiplicarLote(const LoteMatrices<T>& A, const LoteMatrices<T>& B, int hilos = 0) {
+    LoteMatrices<T> C(A.cantidad, A.filas, B.columnas, A.disposicion);
+    if (!multiplicarLote(A.vista(), B.vista(), C.vista(), hilos)) {
+        return LoteMatrices<T>();
+    }
+    return C;
+}
+
+#endif
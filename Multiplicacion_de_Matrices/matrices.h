@@ -0,0 +1,456 @@
+#ifndef MATRICES_H
+#define MATRICES_H
+
+#include <vector>
+#include <algorithm>
+
+#include "transpuesta.h"
+#include "matriz_fija.h"
+
+// Todos los multiplicadores son plantillas sobre el tipo de elemento T (int, long long,
+// double...); el resultado se acumula en el mismo tipo. Para enteros estrechos con
+// acumulación en 32 bits, ver gemm_estrecho.h.
+
+const int UMBRAL = 64;  // Umbral para usar multiplicación tradicional en vez de Strassen
+static_assert(UMBRAL <= LADO_MAXIMO_FIJO, "Las hojas de Strassen deben tener núcleo de tamaño fijo");
+
+const int BLOQUE_FILAS_B = 128;     // Filas de B por bloque en la multiplicación por bloques
+const int BLOQUE_COLUMNAS_B = 256;  // Columnas de B (y de C) por bloque
+const int FILAS_POR_PASO = 4;       // Filas de A que comparten cada fila de B cargada
+
+/**
+ * @brief Multiplicación cúbica tradicional que escribe en una matriz ya existente.
+ *
+ * C se redimensiona con assign, que reutiliza la memoria de sus filas si ya la tenía.
+ *
+ * @param A Primera matriz.
+ * @param B Segunda matriz.
+ * @param filasA Número de filas de la matriz A.
+ * @param columnasA Número de columnas de la matriz A (y filas de la matriz B).
+ * @param columnasB Número de columnas de la matriz B.
+ * @param C Matriz resultante; su contenido anterior se descarta.
+ */
+template <class T>
+void multiplicarMatricesEn(const std::vector<std::vector<T>>& A, const std::vector<std::vector<T>>& B, int filasA, int columnasA, int columnasB,
+                           std::vector<std::vector<T>>& C) {
+    // Inicializar la matriz de resultado con ceros
+    C.resize(filasA);
+    for (auto& fila : C) {
+        fila.assign(columnasB, 0);
+    }
+
+    // Realizar la multiplicación de matrices
+    for (int i = 0; i < filasA; i++) {
+        for (int j = 0; j < columnasB; j++) {
+            for (int k = 0; k < columnasA; k++) {
+                C[i][j] += A[i][k] * B[k][j];
+            }
+        }
+    }
+}
+
+/**
+ * @brief Implementa el algoritmo de multiplicación cúbica tradicional de dos matrices.
+ *
+ * @param A Primera matriz.
+ * @param B Segunda matriz.
+ * @param filasA Número de filas de la matriz A.
+ * @param columnasA Número de columnas de la matriz A (y filas de la matriz B).
+ * @param columnasB Número de columnas de la matriz B.
+ * @return std::vector<std::vector<T>> Matriz resultante de la multiplicación.
+ */
+template <class T>
+std::vector<std::vector<T>> multiplicarMatrices(const std::vector<std::vector<T>>& A, const std::vector<std::vector<T>>& B, int filasA, int columnasA, int columnasB) {
+    std::vector<std::vector<T>> C;
+    multiplicarMatricesEn(A, B, filasA, columnasA, columnasB, C);
+    return C;
+}
+
+/**
+ * @brief Multiplicación cúbica optimizada (con B transpuesta) que escribe en una matriz ya existente.
+ *
+ * C se redimensiona con assign, que reutiliza la memoria de sus filas si ya la tenía; la
+ * transpuesta de B sigue siendo una matriz nueva en cada llamada.
+ *
+ * @param A Primera matriz.
+ * @param B Segunda matriz.
+ * @param filasA Número de filas de la matriz A.
+ * @param columnasA Número de columnas de la matriz A (y filas de la matriz B).
+ * @param columnasB Número de columnas de la matriz B.
+ * @param C Matriz resultante; su contenido anterior se descarta.
+ */
+template <class T>
+void multiplicarMatricesOptimizadoEn(const std::vector<std::vector<T>>& A, const std::vector<std::vector<T>>& B, int filasA, int columnasA, int columnasB,
+                                     std::vector<std::vector<T>>& C) {
+    // Inicializar la matriz de resultado con ceros
+    C.resize(filasA);
+    for (auto& fila : C) {
+        fila.assign(columnasB, 0);
+    }
+
+    // Transponer la matriz B por teselas (ver transpuesta.h)
+    std::vector<std::vector<T>> B_transpuesta = transponer(B);
+
+    // Multiplicar la matriz A con la transpuesta de B para optimizar el acceso a memoria
+    for (int i = 0; i < filasA; i++) {
+        for (int j = 0; j < columnasB; j++) {
+            for (int k = 0; k < columnasA; k++) {
+                C[i][j] += A[i][k] * B_transpuesta[j][k];
+            }
+        }
+    }
+}
+
+/**
+ * @brief Implementa el algoritmo de multiplicación cúbica optimizada mediante la transposición de la matriz B.
+ *
+ * @param A Primera matriz.
+ * @param B Segunda matriz.
+ * @param filasA Número de filas de la matriz A.
+ * @param columnasA Número de columnas de la matriz A (y filas de la matriz B).
+ * @param columnasB Número de columnas de la matriz B.
+ * @return std::vector<std::vector<T>> Matriz resultante de la multiplicación optimizada.
+ */
+template <class T>
+std::vector<std::vector<T>> multiplicarMatricesOptimizado(const std::vector<std::vector<T>>& A, const std::vector<std::vector<T>>& B, int filasA, int columnasA, int columnasB) {
+    std::vector<std::vector<T>> C;
+    multiplicarMatricesOptimizadoEn(A, B, filasA, columnasA, columnasB, C);
+    return C;
+}
+
+/**
+ * @brief Actualiza FILAS filas de C con un bloque de B: C[i..][jj..] += A[i..][kk..kf) · B[kk..kf)[jj..].
+ *
+ * Las filas de C se acumulan en un arreglo local (que no puede solaparse con B), así
+ * el bucle sobre las columnas se vectoriza; cada valor de B se usa para FILAS filas.
+ * Con ANCHO > 0 el ancho del bloque es constante; con ANCHO = 0 se usa 'ancho'.
+ */
+template <int FILAS, int ANCHO, class T>
+void actualizarBloque(const std::vector<std::vector<T>>& A, const std::vector<std::vector<T>>& B, std::vector<std::vector<T>>& C,
+                      int i, int kk, int kf, int jj, int ancho) {
+    const int n = ANCHO > 0 ? ANCHO : ancho;
+    T local[FILAS][BLOQUE_COLUMNAS_B];
+
+    for (int r = 0; r < FILAS; r++) {
+        for (int j = 0; j < n; j++) {
+            local[r][j] = C[i + r][jj + j];
+        }
+    }
+    for (int k = kk; k < kf; k++) {
+        const T* filaB = B[k].data() + jj;
+        T a[FILAS];
+        for (int r = 0; r < FILAS; r++) {
+            a[r] = A[i + r][k];
+        }
+        for (int j = 0; j < n; j++) {
+            T b = filaB[j];
+            for (int r = 0; r < FILAS; r++) {
+                local[r][j] += a[r] * b;
+            }
+        }
+    }
+    for (int r = 0; r < FILAS; r++) {
+        for (int j = 0; j < n; j++) {
+            C[i + r][jj + j] = local[r][j];
+        }
+    }
+}
+
+/**
+ * @brief Multiplicación por bloques (orden i-k-j) que escribe en una matriz ya existente.
+ *
+ * Recorre B en bloques de BLOQUE_FILAS_B x BLOQUE_COLUMNAS_B que caben en la caché L2 y,
+ * para cada bloque, actualiza las filas de C de FILAS_POR_PASO en FILAS_POR_PASO. C se
+ * redimensiona con assign, que reutiliza la memoria de sus filas si ya la tenía.
+ *
+ * @param A Primera matriz (filasA x columnasA).
+ * @param B Segunda matriz (columnasA x columnasB).
+ * @param C Matriz resultante; su contenido anterior se descarta.
+ */
+template <class T>
+void multiplicarMatricesBloquesEn(const std::vector<std::vector<T>>& A, const std::vector<std::vector<T>>& B, std::vector<std::vector<T>>& C) {
+    int filasA = A.size();
+    int columnasA = B.size();
+    int columnasB = B.empty() ? 0 : B[0].size();
+
+    C.resize(filasA);
+    for (auto& fila : C) {
+        fila.assign(columnasB, T());
+    }
+
+    for (int kk = 0; kk < columnasA; kk += BLOQUE_FILAS_B) {
+        int kf = std::min(columnasA, kk + BLOQUE_FILAS_B);
+        for (int jj = 0; jj < columnasB; jj += BLOQUE_COLUMNAS_B) {
+            int ancho = std::min(BLOQUE_COLUMNAS_B, columnasB - jj);
+            bool completo = ancho == BLOQUE_COLUMNAS_B;
+
+            int i = 0;
+            for (; i + FILAS_POR_PASO <= filasA; i += FILAS_POR_PASO) {
+                if (completo) {
+                    actualizarBloque<FILAS_POR_PASO, BLOQUE_COLUMNAS_B>(A, B, C, i, kk, kf, jj, ancho);
+                } else {
+                    actualizarBloque<FILAS_POR_PASO, 0>(A, B, C, i, kk, kf, jj, ancho);
+                }
+            }
+            for (; i < filasA; i++) {
+                actualizarBloque<1, 0>(A, B, C, i, kk, kf, jj, ancho);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Implementa la multiplicación por bloques de dos matrices.
+ *
+ * @param A Primera matriz (filasA x columnasA).
+ * @param B Segunda matriz (columnasA x columnasB).
+ * @return std::vector<std::vector<T>> Matriz resultante de la multiplicación por bloques.
+ */
+template <class T>
+std::vector<std::vector<T>> multiplicarMatricesBloques(const std::vector<std::vector<T>>& A, const std::vector<std::vector<T>>& B) {
+    std::vector<std::vector<T>> C;
+    multiplicarMatricesBloquesEn(A, B, C);
+    return C;
+}
+
+/**
+ * @brief Suma dos matrices del mismo tamaño.
+ *
+ * @param A Primera matriz.
+ * @param B Segunda matriz.
+ * @return std::vector<std::vector<T>> Matriz resultante de la suma.
+ */
+template <class T>
+std::vector<std::vector<T>> sumarMatrices(const std::vector<std::vector<T>>& A, const std::vector<std::vector<T>>& B) {
+    int n = A.size();
+    std::vector<std::vector<T>> C(n, std::vector<T>(n, 0));
+
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            C[i][j] = A[i][j] + B[i][j];
+        }
+    }
+
+    return C;
+}
+
+/**
+ * @brief Resta dos matrices del mismo tamaño.
+ *
+ * @param A Primera matriz.
+ * @param B Segunda matriz.
+ * @return std::vector<std::vector<T>> Matriz resultante de la resta.
+ */
+template <class T>
+std::vector<std::vector<T>> restarMatrices(const std::vector<std::vector<T>>& A, const std::vector<std::vector<T>>& B) {
+    int n = A.size();
+    std::vector<std::vector<T>> C(n, std::vector<T>(n, 0));
+
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            C[i][j] = A[i][j] - B[i][j];
+        }
+    }
+
+    return C;
+}
+
+/**
+ * @brief Multiplicación tradicional (cúbica) de dos matrices cuadradas.
+ *
+ * @param A Primera matriz.
+ * @param B Segunda matriz.
+ * @return std::vector<std::vector<T>> Matriz resultante de la multiplicación tradicional.
+ */
+template <class T>
+std::vector<std::vector<T>> multiplicarMatricesCubic(const std::vector<std::vector<T>>& A, const std::vector<std::vector<T>>& B) {
+    int n = A.size();
+    std::vector<std::vector<T>> C(n, std::vector<T>(n, 0));
+
+    // Multiplicación cúbica estándar
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            for (int k = 0; k < n; k++) {
+                C[i][j] += A[i][k] * B[k][j];
+            }
+        }
+    }
+
+    return C;
+}
+
+/**
+ * @brief Paso recursivo de Strassen con un umbral.
+ *
+ * Requiere matrices cuadradas cuyo tamaño se pueda dividir a la mitad exactamente hasta
+ * quedar en UMBRAL o menos; strassenMultiplicacion se encarga de rellenar las entradas.
+ *
+ * @param A Primera matriz.
+ * @param B Segunda matriz.
+ * @return std::vector<std::vector<T>> Matriz resultante de la multiplicación.
+ */
+template <class T>
+std::vector<std::vector<T>> strassenRecursivo(const std::vector<std::vector<T>>& A, const std::vector<std::vector<T>>& B) {
+    int n = A.size();
+
+    // Si la matriz es lo suficientemente pequeña, usar el núcleo de tamaño fijo de su lado
+    if (n <= UMBRAL) {
+        std::vector<std::vector<T>> C;
+        if (multiplicarCuadradaFija(A, B, C)) {
+            return C;
+        }
+        return multiplicarMatricesCubic(A, B);
+    }
+
+    int nuevoTamano = n / 2;
+
+    // Inicialización de submatrices
+    std::vector<std::vector<T>> A11(nuevoTamano, std::vector<T>(nuevoTamano)), A12(nuevoTamano, std::vector<T>(nuevoTamano)),
+        A21(nuevoTamano, std::vector<T>(nuevoTamano)), A22(nuevoTamano, std::vector<T>(nuevoTamano)),
+        B11(nuevoTamano, std::vector<T>(nuevoTamano)), B12(nuevoTamano, std::vector<T>(nuevoTamano)),
+        B21(nuevoTamano, std::vector<T>(nuevoTamano)), B22(nuevoTamano, std::vector<T>(nuevoTamano));
+
+    // Dividir las matrices A y B en submatrices
+    for (int i = 0; i < nuevoTamano; i++) {
+        for (int j = 0; j < nuevoTamano; j++) {
+            A11[i][j] = A[i][j];
+            A12[i][j] = A[i][j + nuevoTamano];
+            A21[i][j] = A[i + nuevoTamano][j];
+            A22[i][j] = A[i + nuevoTamano][j + nuevoTamano];
+
+            B11[i][j] = B[i][j];
+            B12[i][j] = B[i][j + nuevoTamano];
+            B21[i][j] = B[i + nuevoTamano][j];
+            B22[i][j] = B[i + nuevoTamano][j + nuevoTamano];
+        }
+    }
+
+    // Calcular los productos de Strassen
+    std::vector<std::vector<T>> M1 = strassenRecursivo(sumarMatrices(A11, A22), sumarMatrices(B11, B22));
+    std::vector<std::vector<T>> M2 = strassenRecursivo(sumarMatrices(A21, A22), B11);
+    std::vector<std::vector<T>> M3 = strassenRecursivo(A11, restarMatrices(B12, B22));
+    std::vector<std::vector<T>> M4 = strassenRecursivo(A22, restarMatrices(B21, B11));
+    std::vector<std::vector<T>> M5 = strassenRecursivo(sumarMatrices(A11, A12), B22);
+    std::vector<std::vector<T>> M6 = strassenRecursivo(restarMatrices(A21, A11), sumarMatrices(B11, B12));
+    std::vector<std::vector<T>> M7 = strassenRecursivo(restarMatrices(A12, A22), sumarMatrices(B21, B22));
+
+    // Calcular las submatrices de la matriz resultante C
+    std::vector<std::vector<T>> C11 = sumarMatrices(restarMatrices(sumarMatrices(M1, M4), M5), M7);
+    std::vector<std::vector<T>> C12 = sumarMatrices(M3, M5);
+    std::vector<std::vector<T>> C21 = sumarMatrices(M2, M4);
+    std::vector<std::vector<T>> C22 = sumarMatrices(restarMatrices(sumarMatrices(M1, M3), M2), M6);
+
+    // Unir las submatrices en la matriz resultante
+    std::vector<std::vector<T>> C(n, std::vector<T>(n));
+    for (int i = 0; i < nuevoTamano; i++) {
+        for (int j = 0; j < nuevoTamano; j++) {
+            C[i][j] = C11[i][j];
+            C[i][j + nuevoTamano] = C12[i][j];
+            C[i + nuevoTamano][j] = C21[i][j];
+            C[i + nuevoTamano][j + nuevoTamano] = C22[i][j];
+        }
+    }
+
+    return C;
+}
+
+/**
+ * @brief Copia un bloque cuadrado de una matriz, rellenando con ceros lo que queda fuera de ella.
+ *
+ * @param M Matriz de origen.
+ * @param fila Fila inicial del bloque.
+ * @param columna Columna inicial del bloque.
+ * @param tamano Tamaño del bloque.
+ * @return std::vector<std::vector<T>> Bloque de tamano x tamano.
+ */
+template <class T>
+std::vector<std::vector<T>> extraerBloque(const std::vector<std::vector<T>>& M, int fila, int columna, int tamano) {
+    std::vector<std::vector<T>> bloque(tamano, std::vector<T>(tamano, 0));
+    int filas = M.size();
+    int columnas = M.empty() ? 0 : M[0].size();
+
+    for (int i = 0; i < tamano && fila + i < filas; i++) {
+        for (int j = 0; j < tamano && columna + j < columnas; j++) {
+            bloque[i][j] = M[fila + i][columna + j];
+        }
+    }
+
+    return bloque;
+}
+
+/**
+ * @brief Strassen sobre matrices cuadradas de cualquier tamaño.
+ *
+ * Rellena con ceros hasta hoja·2^d, donde d es el número de divisiones necesarias para
+ * llegar al umbral, de modo que ninguna división pierda la última fila o columna.
+ *
+ * @param A Primera matriz (n x n).
+ * @param B Segunda matriz (n x n).
+ * @return std::vector<std::vector<T>> Matriz resultante (n x n).
+ */
+template <class T>
+std::vector<std::vector<T>> strassenCuadrado(const std::vector<std::vector<T>>& A, const std::vector<std::vector<T>>& B) {
+    int n = A.size();
+    int divisiones = 0;
+    while (((n + (1 << divisiones) - 1) >> divisiones) > UMBRAL) {
+        divisiones++;
+    }
+    int tamano = ((n + (1 << divisiones) - 1) >> divisiones) << divisiones;
+
+    if (tamano == n) {
+        return strassenRecursivo(A, B);
+    }
+
+    // Rellenar, multiplicar y recortar
+    std::vector<std::vector<T>> C = strassenRecursivo(extraerBloque(A, 0, 0, tamano), extraerBloque(B, 0, 0, tamano));
+    C.resize(n);
+    for (auto& fila : C) {
+        fila.resize(n);
+    }
+    return C;
+}
+
+/**
+ * @brief Implementa el algoritmo de multiplicación de matrices de Strassen con un umbral.
+ *
+ * Acepta matrices rectangulares: el producto se divide en bloques cuadrados del tamaño de
+ * la menor dimensión, y cada producto de bloques se calcula con Strassen.
+ *
+ * @param A Primera matriz (filasA x columnasA).
+ * @param B Segunda matriz (columnasA x columnasB).
+ * @return std::vector<std::vector<T>> Matriz resultante de la multiplicación (filasA x columnasB).
+ */
+template <class T>
+std::vector<std::vector<T>> strassenMultiplicacion(const std::vector<std::vector<T>>& A, const std::vector<std::vector<T>>& B) {
+    int filasA = A.size();
+    int columnasA = B.size();
+    int columnasB = B.empty() ? 0 : B[0].size();
+
+    if (filasA == columnasA && columnasA == columnasB) {
+        return strassenCuadrado(A, B);
+    }
+
+    int bloque = std::min(filasA, std::min(columnasA, columnasB));
+    std::vector<std::vector<T>> C(filasA, std::vector<T>(columnasB, 0));
+    if (bloque == 0) {
+        return C;
+    }
+
+    // C(bi, bj) = suma sobre bk de A(bi, bk) * B(bk, bj)
+    for (int bi = 0; bi < filasA; bi += bloque) {
+        for (int bj = 0; bj < columnasB; bj += bloque) {
+            for (int bk = 0; bk < columnasA; bk += bloque) {
+                std::vector<std::vector<T>> parcial = strassenCuadrado(extraerBloque(A, bi, bk, bloque), extraerBloque(B, bk, bj, bloque));
+                for (int i = 0; i < bloque && bi + i < filasA; i++) {
+                    for (int j = 0; j < bloque && bj + j < columnasB; j++) {
+                        C[bi + i][bj + j] += parcial[i][j];
+                    }
+                }
+            }
+        }
+    }
+
+    return C;
+}
+
+#endif
@@ -0,0 +1,204 @@
+#ifndef MATRIZ_FIJA_H
+#define MATRIZ_FIJA_H
+
+#include <vector>
+#include <cstddef>
+#include <utility>
+
+// Matrices cuyas dimensiones son parámetros de plantilla. Con los tamaños conocidos en
+// compilación los bucles no tienen resto, las filas del resultado se acumulan en registros
+// y, hasta LADO_DESENROLLADO, el producto se expande entero con expresiones de pliegue.
+
+const int LADO_DESENROLLADO = 16;  // Dimensión máxima con el producto completamente desenrollado
+const int LADO_MAXIMO_FIJO = 64;   // Matrices cuadradas que multiplicarCuadradaFija atiende (hasta UMBRAL de Strassen)
+const int BYTES_FILA_FIJA = 64;    // Por encima de LADO_DESENROLLADO, las filas se rellenan a múltiplos de esto
+
+/**
+ * @brief Elementos reservados por fila: las columnas, rellenadas a BYTES_FILA_FIJA si no se desenrolla.
+ *
+ * Con filas de un número entero de vectores el compilador vectoriza los bucles de las
+ * columnas sin bucle de resto; las columnas de relleno valen cero y no alteran el producto.
+ */
+template <class T>
+constexpr int pasoFilaFija(int columnas) {
+    const int porLinea = BYTES_FILA_FIJA / sizeof(T) > 0 ? static_cast<int>(BYTES_FILA_FIJA / sizeof(T)) : 1;
+    return columnas <= LADO_DESENROLLADO ? columnas : (columnas + porLinea - 1) / porLinea * porLinea;
+}
+
+/**
+ * @brief Matriz de FILAS x COLUMNAS guardada en la propia estructura (sin memoria dinámica).
+ *
+ * Es un agregado: MatrizFija<int, 2, 2>{{{1, 2}, {3, 4}}} se puede construir y operar en
+ * contextos constexpr.
+ */
+template <class T, int FILAS, int COLUMNAS>
+struct MatrizFija {
+    static_assert(FILAS > 0 && COLUMNAS > 0, "Las dimensiones deben ser positivas");
+
+    static constexpr int filas = FILAS;
+    static constexpr int columnas = COLUMNAS;
+    static constexpr int paso = pasoFilaFija<T>(COLUMNAS);
+
+    T datos[FILAS][paso]{};
+
+    constexpr T& operator()(int i, int j) {
+        return datos[i][j];
+    }
+    constexpr const T& operator()(int i, int j) const {
+        return datos[i][j];
+    }
+};
+
+template <class T, int FILAS, int COLUMNAS>
+constexpr bool operator==(const MatrizFija<T, FILAS, COLUMNAS>& A, const MatrizFija<T, FILAS, COLUMNAS>& B) {
+    for (int i = 0; i < FILAS; i++) {
+        for (int j = 0; j < COLUMNAS; j++) {
+            if (!(A(i, j) == B(i, j))) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Matriz identidad de N x N.
+ */
+template <class T, int N>
+constexpr MatrizFija<T, N, N> identidadFija() {
+    MatrizFija<T, N, N> I{};
+    for (int i = 0; i < N; i++) {
+        I(i, i) = T(1);
+    }
+    return I;
+}
+
+/**
+ * @brief fila += a · b, desenrollado sobre las columnas J.
+ */
+template <class T, int COLUMNAS, std::size_t... J>
+constexpr void acumularFilaFija(T (&fila)[COLUMNAS], T a, const T (&b)[COLUMNAS], std::index_sequence<J...>) {
+    ((fila[J] += a * b[J]), ...);
+}
+
+/**
+ * @brief fila = a · B, desenrollado sobre el índice común K; cada término es una fila de B.
+ */
+template <class T, int INTERIOR, int COLUMNAS, std::size_t... K>
+constexpr void productoFilaFija(T (&fila)[COLUMNAS], const T (&a)[INTERIOR], const MatrizFija<T, INTERIOR, COLUMNAS>& B,
+                                std::index_sequence<K...>) {
+    (acumularFilaFija(fila, a[K], B.datos[K], std::make_index_sequence<COLUMNAS>{}), ...);
+}
+
+/**
+ * @brief Producto C = A·B de matrices de tamaño fijo.
+ *
+ * Cada fila de C se acumula en un arreglo local (que el compilador mantiene en registros)
+ * sumando A(i, k)·fila k de B. Hasta LADO_DESENROLLADO columnas e interior, los bucles
+ * sobre k y j se expanden con plantillas; por encima, se recorren las filas rellenadas
+ * con límites constantes. En ambos casos las sumas siguen el orden de k, como en
+ * multiplicarMatricesCubic.
+ *
+ * @return MatrizFija<T, FILAS, COLUMNAS> Matriz resultante.
+ */
+template <class T, int FILAS, int INTERIOR, int COLUMNAS>
+constexpr MatrizFija<T, FILAS, COLUMNAS> multiplicar(const MatrizFija<T, FILAS, INTERIOR>& A, const MatrizFija<T, INTERIOR, COLUMNAS>& B) {
+    MatrizFija<T, FILAS, COLUMNAS> C{};
+    constexpr int paso = MatrizFija<T, FILAS, COLUMNAS>::paso;
+
+    for (int i = 0; i < FILAS; i++) {
+        T fila[paso]{};
+        if constexpr (INTERIOR <= LADO_DESENROLLADO && COLUMNAS <= LADO_DESENROLLADO) {
+            productoFilaFija(fila, A.datos[i], B, std::make_index_sequence<INTERIOR>{});
+        } else {
+            for (int k = 0; k < INTERIOR; k++) {
+                T a = A.datos[i][k];
+                for (int j = 0; j < paso; j++) {
+                    fila[j] += a * B.datos[k][j];
+                }
+            }
+        }
+        for (int j = 0; j < paso; j++) {
+            C.datos[i][j] = fila[j];
+        }
+    }
+
+    return C;
+}
+
+/**
+ * @brief Multiplica dos matrices N x N de vector<vector<T>> pasando por MatrizFija<T, N, N>.
+ */
+template <class T, int N>
+void multiplicarCuadradaFijaN(const std::vector<std::vector<T>>& A, const std::vector<std::vector<T>>& B, std::vector<std::vector<T>>& C) {
+    MatrizFija<T, N, N> a, b;
+    for (int i = 0; i < N; i++) {
+        for (int j = 0; j < N; j++) {
+            a(i, j) = A[i][j];
+            b(i, j) = B[i][j];
+        }
+    }
+
+    MatrizFija<T, N, N> c = multiplicar(a, b);
+
+    C.assign(N, std::vector<T>(N));
+    for (int i = 0; i < N; i++) {
+        for (int j = 0; j < N; j++) {
+            C[i][j] = c(i, j);
+        }
+    }
+}
+
+template <class T>
+using MultiplicadorFijo = void (*)(const std::vector<std::vector<T>>&, const std::vector<std::vector<T>>&, std::vector<std::vector<T>>&);
+
+/**
+ * @brief Tabla con una instanciación de multiplicarCuadradaFijaN por cada lado de 1 a LADO_MAXIMO_FIJO.
+ */
+template <class T, std::size_t... N>
+const MultiplicadorFijo<T>* tablaMultiplicadoresFijos(std::index_sequence<N...>) {
+    static const MultiplicadorFijo<T> tabla[] = {&multiplicarCuadradaFijaN<T, static_cast<int>(N) + 1>...};
+    return tabla;
+}
+
+/**
+ * @brief Multiplica A·B con el núcleo de tamaño fijo si ambas son cuadradas de lado 1 a LADO_MAXIMO_FIJO.
+ *
+ * El lado se elige en tiempo de ejecución en una tabla de instanciaciones.
+ *
+ * @param A Primera matriz.
+ * @param B Segunda matriz.
+ * @param C Matriz resultante (sólo se modifica si se devuelve true).
+ * @return bool false si la forma no tiene núcleo fijo; el llamador debe usar otro multiplicador.
+ */
+template <class T>
+bool multiplicarCuadradaFija(const std::vector<std::vector<T>>& A, const std::vector<std::vector<T>>& B, std::vector<std::vector<T>>& C) {
+    std::size_t n = A.size();
+    if (n == 0 || n > static_cast<std::size_t>(LADO_MAXIMO_FIJO) || B.size() != n) {
+        return false;
+    }
+    for (std::size_t i = 0; i < n; i++) {
+        if (A[i].size() != n || B[i].size() != n) {
+            return false;
+        }
+    }
+
+    static const MultiplicadorFijo<T>* tabla = tablaMultiplicadoresFijos<T>(std::make_index_sequence<LADO_MAXIMO_FIJO>{});
+    tabla[n - 1](A, B, C);
+    return true;
+}
+
+// Comprobaciones en compilación: el producto se puede evaluar en contextos constexpr,
+// tanto desenrollado como con filas rellenadas.
+static_assert(multiplicar(MatrizFija<int, 2, 3>{{{1, 2, 3}, {4, 5, 6}}}, MatrizFija<int, 3, 2>{{{7, 8}, {9, 10}, {11, 12}}}) ==
+                  MatrizFija<int, 2, 2>{{{58, 64}, {139, 154}}},
+              "Producto fijo de 2x3 por 3x2");
+static_assert(multiplicar(identidadFija<int, 3>(), MatrizFija<int, 3, 3>{{{2, -1, 0}, {0, 3, 7}, {5, 0, -4}}}) ==
+                  MatrizFija<int, 3, 3>{{{2, -1, 0}, {0, 3, 7}, {5, 0, -4}}},
+              "La identidad es neutra");
+static_assert(multiplicar(identidadFija<long long, LADO_DESENROLLADO + 1>(), identidadFija<long long, LADO_DESENROLLADO + 1>()) ==
+                  identidadFija<long long, LADO_DESENROLLADO + 1>(),
+              "Producto con filas rellenadas");
+static_assert(MatrizFija<int, 3, LADO_DESENROLLADO + 1>::paso % (BYTES_FILA_FIJA / sizeof(int)) == 0, "Las filas largas se rellenan");
+
+#endif
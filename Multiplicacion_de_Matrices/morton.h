@@ -0,0 +1,389 @@
+#ifndef MORTON_H
+#define MORTON_H
+
+#include <vector>
+#include <algorithm>
+
+// Disposición por teselas en orden de Morton (curva Z): la matriz se rellena con ceros hasta
+// un cuadrado de LADO_TESELA_MORTON·2^d, se parte en teselas de LADO_TESELA_MORTON x
+// LADO_TESELA_MORTON guardadas por filas, y las teselas se ordenan entrelazando los bits de
+// su fila y su columna. Así cada cuadrante de cualquier bloque alineado ocupa un tramo
+// contiguo de memoria: dividir en A11..A22 es sumar un desplazamiento al puntero.
+
+const int LADO_TESELA_MORTON = 32;        // Lado de las teselas guardadas por filas
+const int FILAS_TESELA_MORTON = 2;        // Filas de C acumuladas a la vez; con más, la tesela local no cabe en los registros SSE
+const int TESELAS_STRASSEN_MORTON = 4;    // Por debajo de este número de teselas por lado, Strassen usa la recursión clásica
+
+/**
+ * @brief Matriz guardada por teselas en orden de Morton.
+ */
+template <class T>
+struct MatrizMorton {
+    int filas = 0;         // Filas reales (sin el relleno)
+    int columnas = 0;      // Columnas reales (sin el relleno)
+    int teselas = 0;       // Teselas por lado, potencia de dos
+    std::vector<T> datos;
+
+    MatrizMorton() {}
+
+    MatrizMorton(int filas, int columnas, int teselas)
+        : filas(filas), columnas(columnas), teselas(teselas),
+          datos(static_cast<size_t>(teselas) * teselas * LADO_TESELA_MORTON * LADO_TESELA_MORTON, T()) {}
+};
+
+/**
+ * @brief Posición de la tesela (fila, columna) en el orden de Morton: entrelaza sus bits, con los de la fila por encima.
+ */
+inline size_t indiceMorton(int fila, int columna) {
+    size_t indice = 0;
+    for (int bit = 0; bit < 16; bit++) {
+        indice |= static_cast<size_t>((columna >> bit) & 1) << (2 * bit);
+        indice |= static_cast<size_t>((fila >> bit) & 1) << (2 * bit + 1);
+    }
+    return indice;
+}
+
+/**
+ * @brief Menor número de teselas por lado (potencia de dos) que cubre 'dimension' elementos.
+ */
+inline int teselasMorton(int dimension) {
+    int teselas = 1;
+    while (teselas * LADO_TESELA_MORTON < dimension) {
+        teselas *= 2;
+    }
+    return teselas;
+}
+
+/**
+ * @brief Convierte una matriz guardada por filas a la disposición de Morton.
+ *
+ * @param M Matriz de origen.
+ * @param teselas Teselas por lado; con 0 se usan las mínimas que cubren la matriz. Para
+ *                multiplicar, los operandos deben compartir este valor.
+ * @return MatrizMorton<T> Matriz rellenada con ceros.
+ */
+template <class T>
+MatrizMorton<T> mortonDesdeFilas(const std::vector<std::vector<T>>& M, int teselas = 0) {
+    const int H = LADO_TESELA_MORTON;
+    int filas = M.size();
+    int columnas = M.empty() ? 0 : M[0].size();
+    if (teselas == 0) {
+        teselas = teselasMorton(std::max(filas, columnas));
+    }
+
+    MatrizMorton<T> resultado(filas, columnas, teselas);
+    for (int tf = 0; tf * H < filas; tf++) {
+        for (int tc = 0; tc * H < columnas; tc++) {
+            T* tesela = resultado.datos.data() + indiceMorton(tf, tc) * H * H;
+            int ancho = std::min(H, columnas - tc * H);
+            for (int r = 0; r < H && tf * H + r < filas; r++) {
+                const T* origen = M[tf * H + r].data() + tc * H;
+                std::copy(origen, origen + ancho, tesela + r * H);
+            }
+        }
+    }
+    return resultado;
+}
+
+/**
+ * @brief Convierte una matriz de Morton a la disposición por filas, sin el relleno.
+ */
+template <class T>
+std::vector<std::vector<T>> filasDesdeMorton(const MatrizMorton<T>& M) {
+    const int H = LADO_TESELA_MORTON;
+    std::vector<std::vector<T>> resultado(M.filas, std::vector<T>(M.columnas));
+    for (int tf = 0; tf * H < M.filas; tf++) {
+        for (int tc = 0; tc * H < M.columnas; tc++) {
+            const T* tesela = M.datos.data() + indiceMorton(tf, tc) * H * H;
+            int ancho = std::min(H, M.columnas - tc * H);
+            for (int r = 0; r < H && tf * H + r < M.filas; r++) {
+                std::copy(tesela + r * H, tesela + r * H + ancho, resultado[tf * H + r].data() + tc * H);
+            }
+        }
+    }
+    return resultado;
+}
+
+/**
+ * @brief C += A · B sobre una tesela de cada operando.
+ *
+ * Como en actualizarBloque, las filas de C se acumulan en un arreglo local y el ancho es
+ * constante, de modo que el bucle sobre las columnas se vectoriza.
+ */
+template <class T>
+void productoTeselas(const T* A, const T* B, T* C) {
+    const int H = LADO_TESELA_MORTON;
+    const int FILAS = FILAS_TESELA_MORTON;
+    T local[FILAS][H];
+
+    for (int i = 0; i < H; i += FILAS) {
+        for (int r = 0; r < FILAS; r++) {
+            for (int j = 0; j < H; j++) {
+                local[r][j] = C[(i + r) * H + j];
+            }
+        }
+        for (int k = 0; k < H; k++) {
+            const T* filaB = B + k * H;
+            T a[FILAS];
+            for (int r = 0; r < FILAS; r++) {
+                a[r] = A[(i + r) * H + k];
+            }
+            for (int j = 0; j < H; j++) {
+                T b = filaB[j];
+                for (int r = 0; r < FILAS; r++) {
+                    local[r][j] += a[r] * b;
+                }
+            }
+        }
+        for (int r = 0; r < FILAS; r++) {
+            for (int j = 0; j < H; j++) {
+                C[(i + r) * H + j] = local[r][j];
+            }
+        }
+    }
+}
+
+/**
+ * @brief C += A · B sobre bloques de 'teselas' x 'teselas' teselas, dividiendo en cuadrantes.
+ *
+ * No hay tamaños de bloque que ajustar: en algún nivel de la recursión los tres bloques
+ * caben en cada nivel de caché. Los cuadrantes que caen por completo en el relleno se
+ * saltan, así que las matrices rectangulares no pagan el cuadrado en el que se guardan.
+ *
+ * @param filas, interior, columnas Teselas con datos que quedan desde el origen del bloque
+ *        en las filas de A, en las columnas de A (filas de B) y en las columnas de B.
+ */
+template <class T>
+void productoMortonRecursivo(const T* A, const T* B, T* C, int teselas, int filas, int interior, int columnas) {
+    if (filas <= 0 || interior <= 0 || columnas <= 0) {
+        return;
+    }
+    if (teselas == 1) {
+        productoTeselas(A, B, C);
+        return;
+    }
+
+    int m = teselas / 2;
+    size_t cuarto = static_cast<size_t>(m) * m * LADO_TESELA_MORTON * LADO_TESELA_MORTON;
+    const T *A00 = A, *A01 = A + cuarto, *A10 = A + 2 * cuarto, *A11 = A + 3 * cuarto;
+    const T *B00 = B, *B01 = B + cuarto, *B10 = B + 2 * cuarto, *B11 = B + 3 * cuarto;
+    T *C00 = C, *C01 = C + cuarto, *C10 = C + 2 * cuarto, *C11 = C + 3 * cuarto;
+    int f0 = std::min(filas, m), f1 = filas - m;
+    int k0 = std::min(interior, m), k1 = interior - m;
+    int c0 = std::min(columnas, m), c1 = columnas - m;
+
+    // Orden en el que cada producto comparte un operando con el anterior
+    productoMortonRecursivo(A00, B00, C00, m, f0, k0, c0);
+    productoMortonRecursivo(A00, B01, C01, m, f0, k0, c1);
+    productoMortonRecursivo(A10, B01, C11, m, f1, k0, c1);
+    productoMortonRecursivo(A10, B00, C10, m, f1, k0, c0);
+    productoMortonRecursivo(A11, B10, C10, m, f1, k1, c0);
+    productoMortonRecursivo(A11, B11, C11, m, f1, k1, c1);
+    productoMortonRecursivo(A01, B11, C01, m, f0, k1, c1);
+    productoMortonRecursivo(A01, B10, C00, m, f0, k1, c0);
+}
+
+/**
+ * @brief z = x + signo · y sobre tramos contiguos de n elementos.
+ */
+template <class T>
+void combinarTramos(const T* x, const T* y, T* z, size_t n, int signo) {
+    if (signo > 0) {
+        for (size_t i = 0; i < n; i++) {
+            z[i] = x[i] + y[i];
+        }
+    } else {
+        for (size_t i = 0; i < n; i++) {
+            z[i] = x[i] - y[i];
+        }
+    }
+}
+
+/**
+ * @brief z += signo · x sobre tramos contiguos de n elementos.
+ */
+template <class T>
+void acumularTramo(T* z, const T* x, size_t n, int signo) {
+    if (signo > 0) {
+        for (size_t i = 0; i < n; i++) {
+            z[i] += x[i];
+        }
+    } else {
+        for (size_t i = 0; i < n; i++) {
+            z[i] -= x[i];
+        }
+    }
+}
+
+/**
+ * @brief C += A · B con Strassen sobre la disposición de Morton.
+ *
+ * Los cuadrantes son punteros dentro de A, B y C, así que no se copian; sólo las sumas
+ * de cuadrantes y cada producto Mi necesitan espacio, 3 cuadrantes por nivel tomados de
+ * 'espacio'. Cuando algún cuadrante queda por completo en el relleno, el nivel usa los
+ * ocho productos de la recursión clásica para no multiplicar ceros.
+ *
+ * @param filas, interior, columnas Teselas con datos desde el origen del bloque (ver productoMortonRecursivo).
+ * @param espacio Memoria de trabajo de al menos 3·(teselas·LADO_TESELA_MORTON)²/4·(1 + 1/4 + ...) elementos.
+ */
+template <class T>
+void strassenMortonRecursivo(const T* A, const T* B, T* C, int teselas, int filas, int interior, int columnas, T* espacio) {
+    if (filas <= 0 || interior <= 0 || columnas <= 0) {
+        return;
+    }
+    if (teselas <= TESELAS_STRASSEN_MORTON) {
+        productoMortonRecursivo(A, B, C, teselas, filas, interior, columnas);
+        return;
+    }
+
+    int m = teselas / 2;
+    size_t cuarto = static_cast<size_t>(m) * m * LADO_TESELA_MORTON * LADO_TESELA_MORTON;
+    const T *A00 = A, *A01 = A + cuarto, *A10 = A + 2 * cuarto, *A11 = A + 3 * cuarto;
+    const T *B00 = B, *B01 = B + cuarto, *B10 = B + 2 * cuarto, *B11 = B + 3 * cuarto;
+    T *C00 = C, *C01 = C + cuarto, *C10 = C + 2 * cuarto, *C11 = C + 3 * cuarto;
+    T* siguiente = espacio + 3 * cuarto;
+
+    if (filas <= m || interior <= m || columnas <= m) {
+        int f0 = std::min(filas, m), f1 = filas - m;
+        int k0 = std::min(interior, m), k1 = interior - m;
+        int c0 = std::min(columnas, m), c1 = columnas - m;
+        strassenMortonRecursivo(A00, B00, C00, m, f0, k0, c0, espacio);
+        strassenMortonRecursivo(A00, B01, C01, m, f0, k0, c1, espacio);
+        strassenMortonRecursivo(A10, B01, C11, m, f1, k0, c1, espacio);
+        strassenMortonRecursivo(A10, B00, C10, m, f1, k0, c0, espacio);
+        strassenMortonRecursivo(A11, B10, C10, m, f1, k1, c0, espacio);
+        strassenMortonRecursivo(A11, B11, C11, m, f1, k1, c1, espacio);
+        strassenMortonRecursivo(A01, B11, C01, m, f0, k1, c1, espacio);
+        strassenMortonRecursivo(A01, B10, C00, m, f0, k1, c0, espacio);
+        return;
+    }
+
+    T* sumaA = espacio;
+    T* sumaB = espacio + cuarto;
+    T* producto = espacio + 2 * cuarto;
+
+    // Calcula producto = X · Y desde cero; los cuadrantes que se combinan ya no tienen relleno que saltar
+    auto multiplicar = [&](const T* X, const T* Y) {
+        std::fill(producto, producto + cuarto, T());
+        strassenMortonRecursivo(X, Y, producto, m, m, m, m, siguiente);
+    };
+
+    // M1 = (A00 + A11)(B00 + B11)
+    combinarTramos(A00, A11, sumaA, cuarto, 1);
+    combinarTramos(B00, B11, sumaB, cuarto, 1);
+    multiplicar(sumaA, sumaB);
+    acumularTramo(C00, producto, cuarto, 1);
+    acumularTramo(C11, producto, cuarto, 1);
+
+    // M2 = (A10 + A11) B00
+    combinarTramos(A10, A11, sumaA, cuarto, 1);
+    multiplicar(sumaA, B00);
+    acumularTramo(C10, producto, cuarto, 1);
+    acumularTramo(C11, producto, cuarto, -1);
+
+    // M3 = A00 (B01 - B11)
+    combinarTramos(B01, B11, sumaB, cuarto, -1);
+    multiplicar(A00, sumaB);
+    acumularTramo(C01, producto, cuarto, 1);
+    acumularTramo(C11, producto, cuarto, 1);
+
+    // M4 = A11 (B10 - B00)
+    combinarTramos(B10, B00, sumaB, cuarto, -1);
+    multiplicar(A11, sumaB);
+    acumularTramo(C00, producto, cuarto, 1);
+    acumularTramo(C10, producto, cuarto, 1);
+
+    // M5 = (A00 + A01) B11
+    combinarTramos(A00, A01, sumaA, cuarto, 1);
+    multiplicar(sumaA, B11);
+    acumularTramo(C00, producto, cuarto, -1);
+    acumularTramo(C01, producto, cuarto, 1);
+
+    // M6 = (A10 - A00)(B00 + B01)
+    combinarTramos(A10, A00, sumaA, cuarto, -1);
+    combinarTramos(B00, B01, sumaB, cuarto, 1);
+    multiplicar(sumaA, sumaB);
+    acumularTramo(C11, producto, cuarto, 1);
+
+    // M7 = (A01 - A11)(B10 + B11)
+    combinarTramos(A01, A11, sumaA, cuarto, -1);
+    combinarTramos(B10, B11, sumaB, cuarto, 1);
+    multiplicar(sumaA, sumaB);
+    acumularTramo(C00, producto, cuarto, 1);
+}
+
+/**
+ * @brief Teselas con datos en una dimensión de 'elementos' elementos.
+ */
+inline int teselasOcupadas(int elementos) {
+    return (elementos + LADO_TESELA_MORTON - 1) / LADO_TESELA_MORTON;
+}
+
+/**
+ * @brief Multiplica dos matrices de Morton con la recursión por cuadrantes.
+ *
+ * @param A Primera matriz (filasA x columnasA).
+ * @param B Segunda matriz (columnasA x columnasB), con las mismas teselas por lado que A.
+ * @return MatrizMorton<T> Matriz resultante (filasA x columnasB); vacía si las dimensiones no encajan.
+ */
+template <class T>
+MatrizMorton<T> multiplicarMorton(const MatrizMorton<T>& A, const MatrizMorton<T>& B) {
+    if (A.columnas != B.filas || A.teselas != B.teselas) {
+        return MatrizMorton<T>();
+    }
+    MatrizMorton<T> C(A.filas, B.columnas, A.teselas);
+    productoMortonRecursivo(A.datos.data(), B.datos.data(), C.datos.data(), A.teselas,
+                            teselasOcupadas(A.filas), teselasOcupadas(A.columnas), teselasOcupadas(B.columnas));
+    return C;
+}
+
+/**
+ * @brief Multiplica dos matrices de Morton con Strassen, sin copiar los cuadrantes.
+ *
+ * @param A Primera matriz (filasA x columnasA).
+ * @param B Segunda matriz (columnasA x columnasB), con las mismas teselas por lado que A.
+ * @return MatrizMorton<T> Matriz resultante (filasA x columnasB); vacía si las dimensiones no encajan.
+ */
+template <class T>
+MatrizMorton<T> strassenMorton(const MatrizMorton<T>& A, const MatrizMorton<T>& B) {
+    if (A.columnas != B.filas || A.teselas != B.teselas) {
+        return MatrizMorton<T>();
+    }
+    MatrizMorton<T> C(A.filas, B.columnas, A.teselas);
+
+    // Tres cuadrantes por nivel: 3·(n²/4 + n²/16 + ...) < n²
+    std::vector<T> espacio(C.datos.size());
+    strassenMortonRecursivo(A.datos.data(), B.datos.data(), C.datos.data(), A.teselas,
+                            teselasOcupadas(A.filas), teselasOcupadas(A.columnas), teselasOcupadas(B.columnas), espacio.data());
+    return C;
+}
+
+/**
+ * @brief Multiplicación recursiva sobre Morton de matrices guardadas por filas, incluyendo las conversiones.
+ *
+ * @param A Primera matriz (filasA x columnasA).
+ * @param B Segunda matriz (columnasA x columnasB).
+ * @return std::vector<std::vector<T>> Matriz resultante (filasA x columnasB).
+ */
+template <class T>
+std::vector<std::vector<T>> multiplicarMatricesMorton(const std::vector<std::vector<T>>& A, const std::vector<std::vector<T>>& B) {
+    int columnasB = B.empty() ? 0 : B[0].size();
+    int teselas = teselasMorton(std::max<int>({static_cast<int>(A.size()), static_cast<int>(B.size()), columnasB}));
+    return filasDesdeMorton(multiplicarMorton(mortonDesdeFilas(A, teselas), mortonDesdeFilas(B, teselas)));
+}
+
+/**
+ * @brief Strassen sobre Morton de matrices guardadas por filas, incluyendo las conversiones.
+ *
+ * @param A Primera matriz (filasA x columnasA).
+ * @param B Segunda matriz (columnasA x columnasB).
+ * @return std::vector<std::vector<T>> Matriz resultante (filasA x columnasB).
+ */
+template <class T>
+std::vector<std::vector<T>> strassenMultiplicacionMorton(const std::vector<std::vector<T>>& A, const std::vector<std::vector<T>>& B) {
+    int columnasB = B.empty() ? 0 : B[0].size();
+    int teselas = teselasMorton(std::max<int>({static_cast<int>(A.size()), static_cast<int>(B.size()), columnasB}));
+    return filasDesdeMorton(strassenMorton(mortonDesdeFilas(A, teselas), mortonDesdeFilas(B, teselas)));
+}
+
+#endif
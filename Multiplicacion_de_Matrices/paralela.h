@@ -0,0 +1,183 @@
+#ifndef PARALELA_H
+#define PARALELA_H
+
+#include <vector>
+#include <algorithm>
+#include <cstddef>
+#include "matrices.h"
+#include "../Data_sets/memoria_numa.h"
+
+// Multiplicación por bloques repartida por filas de C entre los trabajadores de un
+// GrupoHilos, sobre matrices planas en BufferGrande. Cada trabajador inicializa (primer
+// toque) las filas de A y de C que le tocan, de modo que en una máquina NUMA las lee y
+// escribe en la memoria de su nodo; B se reparte igual y la leen todos.
+
+const std::size_t BYTES_FILA_PLANA = 64;  // Las filas se rellenan a líneas de caché completas
+
+/**
+ * @brief Matriz por filas en un único BufferGrande, con las filas rellenadas a BYTES_FILA_PLANA.
+ */
+template <class T>
+struct MatrizPlana {
+    int filas = 0;
+    int columnas = 0;
+    int paso = 0;  // Elementos reservados por fila
+    BufferGrande<T> datos;
+
+    MatrizPlana() = default;
+
+    MatrizPlana(int filas, int columnas, PaginasBuffer paginas) : filas(filas), columnas(columnas) {
+        const int porLinea = BYTES_FILA_PLANA / sizeof(T) > 0 ? static_cast<int>(BYTES_FILA_PLANA / sizeof(T)) : 1;
+        paso = (columnas + porLinea - 1) / porLinea * porLinea;
+        datos = BufferGrande<T>(static_cast<std::size_t>(filas) * paso, paginas);
+    }
+
+    T* fila(int i) {
+        return datos.data() + static_cast<std::size_t>(i) * paso;
+    }
+    const T* fila(int i) const {
+        return datos.data() + static_cast<std::size_t>(i) * paso;
+    }
+};
+
+/**
+ * @brief Copia una matriz a una MatrizPlana; con primer toque, cada trabajador copia sus filas.
+ */
+template <class T>
+MatrizPlana<T> copiarMatrizPlana(const std::vector<std::vector<T>>& M, GrupoHilos& grupo, const ConfiguracionNuma& configuracion) {
+    int filas = M.size();
+    int columnas = M.empty() ? 0 : M[0].size();
+    MatrizPlana<T> plana(filas, columnas, configuracion.paginas);
+    inicializarPorPartes(grupo, configuracion, filas, 1, [&](std::size_t primera, std::size_t ultima) {
+        for (std::size_t i = primera; i < ultima; i++) {
+            std::copy(M[i].begin(), M[i].end(), plana.fila(static_cast<int>(i)));
+        }
+    });
+    return plana;
+}
+
+/**
+ * @brief Actualiza FILAS filas de C con un bloque de B, como actualizarBloque pero con punteros y pasos.
+ */
+template <int FILAS, int ANCHO, class T>
+void actualizarBloquePlano(const MatrizPlana<T>& A, const MatrizPlana<T>& B, MatrizPlana<T>& C, int i, int kk, int kf, int jj, int ancho) {
+    const int n = ANCHO > 0 ? ANCHO : ancho;
+    T local[FILAS][BLOQUE_COLUMNAS_B];
+
+    for (int r = 0; r < FILAS; r++) {
+        const T* filaC = C.fila(i + r) + jj;
+        for (int j = 0; j < n; j++) {
+            local[r][j] = filaC[j];
+        }
+    }
+    for (int k = kk; k < kf; k++) {
+        const T* filaB = B.fila(k) + jj;
+        T a[FILAS];
+        for (int r = 0; r < FILAS; r++) {
+            a[r] = A.fila(i + r)[k];
+        }
+        for (int j = 0; j < n; j++) {
+            T b = filaB[j];
+            for (int r = 0; r < FILAS; r++) {
+                local[r][j] += a[r] * b;
+            }
+        }
+    }
+    for (int r = 0; r < FILAS; r++) {
+        T* filaC = C.fila(i + r) + jj;
+        for (int j = 0; j < n; j++) {
+            filaC[j] = local[r][j];
+        }
+    }
+}
+
+/**
+ * @brief Multiplicación por bloques de las filas [primera, ultima) de C = A·B.
+ */
+template <class T>
+void multiplicarFilasPlanas(const MatrizPlana<T>& A, const MatrizPlana<T>& B, MatrizPlana<T>& C, int primera, int ultima) {
+    int columnasA = B.filas;
+    int columnasB = B.columnas;
+
+    for (int kk = 0; kk < columnasA; kk += BLOQUE_FILAS_B) {
+        int kf = std::min(columnasA, kk + BLOQUE_FILAS_B);
+        for (int jj = 0; jj < columnasB; jj += BLOQUE_COLUMNAS_B) {
+            int ancho = std::min(BLOQUE_COLUMNAS_B, columnasB - jj);
+            bool completo = ancho == BLOQUE_COLUMNAS_B;
+
+            int i = primera;
+            for (; i + FILAS_POR_PASO <= ultima; i += FILAS_POR_PASO) {
+                if (completo) {
+                    actualizarBloquePlano<FILAS_POR_PASO, BLOQUE_COLUMNAS_B>(A, B, C, i, kk, kf, jj, ancho);
+                } else {
+                    actualizarBloquePlano<FILAS_POR_PASO, 0>(A, B, C, i, kk, kf, jj, ancho);
+                }
+            }
+            for (; i < ultima; i++) {
+                actualizarBloquePlano<1, 0>(A, B, C, i, kk, kf, jj, ancho);
+            }
+        }
+    }
+}
+
+/**
+ * @brief C = A·B repartiendo las filas de C entre los trabajadores del grupo.
+ *
+ * El trabajador h pone a cero y calcula siempre el mismo rango de filas, que es el mismo
+ * que copió de A en copiarMatrizPlana; con primer toque, C se reserva sin tocar y cada
+ * página de C la escribe primero el trabajador que la calcula.
+ *
+ * @param A Primera matriz (filasA x columnasA).
+ * @param B Segunda matriz (columnasA x columnasB).
+ * @param grupo Trabajadores.
+ * @param configuracion Páginas del resultado y si se usa el primer toque.
+ * @return MatrizPlana<T> Matriz resultante.
+ */
+template <class T>
+MatrizPlana<T> multiplicarPlanaParalela(const MatrizPlana<T>& A, const MatrizPlana<T>& B, GrupoHilos& grupo, const ConfiguracionNuma& configuracion) {
+    MatrizPlana<T> C(A.filas, B.columnas, configuracion.paginas);
+    if (!configuracion.primerToque) {
+        std::fill(C.datos.begin(), C.datos.end(), T());
+    }
+    grupo.ejecutar([&](int h, int hilos) {
+        std::pair<std::size_t, std::size_t> rango = rangoHilo(A.filas, h, hilos);
+        int primera = static_cast<int>(rango.first);
+        int ultima = static_cast<int>(rango.second);
+        if (configuracion.primerToque && ultima > primera) {
+            std::fill(C.fila(primera), C.fila(ultima), T());
+        }
+        multiplicarFilasPlanas(A, B, C, primera, ultima);
+    });
+    return C;
+}
+
+/**
+ * @brief Convierte una MatrizPlana a vector<vector<T>> (sin las columnas de relleno).
+ */
+template <class T>
+std::vector<std::vector<T>> aMatrizDensa(const MatrizPlana<T>& M) {
+    std::vector<std::vector<T>> densa(M.filas);
+    for (int i = 0; i < M.filas; i++) {
+        densa[i].assign(M.fila(i), M.fila(i) + M.columnas);
+    }
+    return densa;
+}
+
+/**
+ * @brief Multiplica A·B en paralelo con la configuración de memoria dada.
+ *
+ * @param A Primera matriz (filasA x columnasA).
+ * @param B Segunda matriz (columnasA x columnasB).
+ * @param configuracion Páginas, primer toque, afinidad y número de hilos.
+ * @return std::vector<std::vector<T>> Matriz resultante.
+ */
+template <class T>
+std::vector<std::vector<T>> multiplicarMatricesParalelo(const std::vector<std::vector<T>>& A, const std::vector<std::vector<T>>& B,
+                                                        const ConfiguracionNuma& configuracion = {}) {
+    GrupoHilos grupo(configuracion.hilos, configuracion.fijarHilos);
+    MatrizPlana<T> planaA = copiarMatrizPlana(A, grupo, configuracion);
+    MatrizPlana<T> planaB = copiarMatrizPlana(B, grupo, configuracion);
+    return aMatrizDensa(multiplicarPlanaParalela(planaA, planaB, grupo, configuracion));
+}
+
+#endif
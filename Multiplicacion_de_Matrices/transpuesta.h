@@ -0,0 +1,381 @@
+#ifndef TRANSPUESTA_H
+#define TRANSPUESTA_H
+
+#include <vector>
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__) || defined(__AVX__)
+#include <immintrin.h>
+#endif
+
+const int HOJA_TRANSPUESTA = 64;    // Lado máximo de las submatrices que ya no se dividen
+const int BLOQUE_EN_SITIO = 64;     // Lado de los bloques que se intercambian en la transpuesta en sitio
+
+/**
+ * @brief Lado de las teselas que se transponen dentro de registros para elementos de tipo T.
+ *
+ * 8x8 para tipos de 32 bits con AVX2, 4x4 para tipos de 32 bits con SSE2 y para tipos de
+ * 64 bits con AVX, y 1 (elemento a elemento) en los demás casos.
+ */
+template <class T>
+constexpr int ladoTesela() {
+    if (!std::is_trivially_copyable<T>::value) {
+        return 1;
+    }
+#if defined(__AVX2__)
+    if (sizeof(T) == 4) {
+        return 8;
+    }
+#endif
+#if defined(__SSE2__)
+    if (sizeof(T) == 4) {
+        return 4;
+    }
+#endif
+#if defined(__AVX__)
+    if (sizeof(T) == 8) {
+        return 4;
+    }
+#endif
+    return 1;
+}
+
+/**
+ * @brief Transpone una tesela de ladoTesela<T>() x ladoTesela<T>() en registros.
+ *
+ * @param origen Punteros al primer elemento de cada fila de la tesela de origen.
+ * @param destino Punteros al primer elemento de cada fila de la tesela de destino.
+ */
+template <class T>
+void transponerTesela(const T* const* origen, T* const* destino) {
+    constexpr int LADO = ladoTesela<T>();
+#if defined(__AVX2__)
+    if constexpr (LADO == 8 && sizeof(T) == 4) {
+        __m256i r0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(origen[0]));
+        __m256i r1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(origen[1]));
+        __m256i r2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(origen[2]));
+        __m256i r3 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(origen[3]));
+        __m256i r4 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(origen[4]));
+        __m256i r5 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(origen[5]));
+        __m256i r6 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(origen[6]));
+        __m256i r7 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(origen[7]));
+
+        // Pares de filas, luego cuartetos, y por último las mitades de 128 bits. Se usan
+        // variables sueltas en lugar de arreglos para que no se guarden en la pila.
+        __m256i t0 = _mm256_unpacklo_epi32(r0, r1);
+        __m256i t1 = _mm256_unpackhi_epi32(r0, r1);
+        __m256i t2 = _mm256_unpacklo_epi32(r2, r3);
+        __m256i t3 = _mm256_unpackhi_epi32(r2, r3);
+        __m256i t4 = _mm256_unpacklo_epi32(r4, r5);
+        __m256i t5 = _mm256_unpackhi_epi32(r4, r5);
+        __m256i t6 = _mm256_unpacklo_epi32(r6, r7);
+        __m256i t7 = _mm256_unpackhi_epi32(r6, r7);
+
+        __m256i u0 = _mm256_unpacklo_epi64(t0, t2);
+        __m256i u1 = _mm256_unpackhi_epi64(t0, t2);
+        __m256i u2 = _mm256_unpacklo_epi64(t1, t3);
+        __m256i u3 = _mm256_unpackhi_epi64(t1, t3);
+        __m256i u4 = _mm256_unpacklo_epi64(t4, t6);
+        __m256i u5 = _mm256_unpackhi_epi64(t4, t6);
+        __m256i u6 = _mm256_unpacklo_epi64(t5, t7);
+        __m256i u7 = _mm256_unpackhi_epi64(t5, t7);
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(destino[0]), _mm256_permute2x128_si256(u0, u4, 0x20));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(destino[1]), _mm256_permute2x128_si256(u1, u5, 0x20));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(destino[2]), _mm256_permute2x128_si256(u2, u6, 0x20));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(destino[3]), _mm256_permute2x128_si256(u3, u7, 0x20));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(destino[4]), _mm256_permute2x128_si256(u0, u4, 0x31));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(destino[5]), _mm256_permute2x128_si256(u1, u5, 0x31));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(destino[6]), _mm256_permute2x128_si256(u2, u6, 0x31));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(destino[7]), _mm256_permute2x128_si256(u3, u7, 0x31));
+        return;
+    }
+#endif
+#if defined(__SSE2__)
+    if constexpr (LADO == 4 && sizeof(T) == 4) {
+        __m128i r0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(origen[0]));
+        __m128i r1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(origen[1]));
+        __m128i r2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(origen[2]));
+        __m128i r3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(origen[3]));
+        __m128i t0 = _mm_unpacklo_epi32(r0, r1);
+        __m128i t1 = _mm_unpackhi_epi32(r0, r1);
+        __m128i t2 = _mm_unpacklo_epi32(r2, r3);
+        __m128i t3 = _mm_unpackhi_epi32(r2, r3);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destino[0]), _mm_unpacklo_epi64(t0, t2));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destino[1]), _mm_unpackhi_epi64(t0, t2));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destino[2]), _mm_unpacklo_epi64(t1, t3));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destino[3]), _mm_unpackhi_epi64(t1, t3));
+        return;
+    }
+#endif
+#if defined(__AVX__)
+    if constexpr (LADO == 4 && sizeof(T) == 8) {
+        __m256d r0 = _mm256_loadu_pd(reinterpret_cast<const double*>(origen[0]));
+        __m256d r1 = _mm256_loadu_pd(reinterpret_cast<const double*>(origen[1]));
+        __m256d r2 = _mm256_loadu_pd(reinterpret_cast<const double*>(origen[2]));
+        __m256d r3 = _mm256_loadu_pd(reinterpret_cast<const double*>(origen[3]));
+        __m256d t0 = _mm256_unpacklo_pd(r0, r1);
+        __m256d t1 = _mm256_unpackhi_pd(r0, r1);
+        __m256d t2 = _mm256_unpacklo_pd(r2, r3);
+        __m256d t3 = _mm256_unpackhi_pd(r2, r3);
+        _mm256_storeu_pd(reinterpret_cast<double*>(destino[0]), _mm256_permute2f128_pd(t0, t2, 0x20));
+        _mm256_storeu_pd(reinterpret_cast<double*>(destino[1]), _mm256_permute2f128_pd(t1, t3, 0x20));
+        _mm256_storeu_pd(reinterpret_cast<double*>(destino[2]), _mm256_permute2f128_pd(t0, t2, 0x31));
+        _mm256_storeu_pd(reinterpret_cast<double*>(destino[3]), _mm256_permute2f128_pd(t1, t3, 0x31));
+        return;
+    }
+#endif
+    for (int i = 0; i < LADO; i++) {
+        for (int j = 0; j < LADO; j++) {
+            destino[j][i] = origen[i][j];
+        }
+    }
+}
+
+/**
+ * @brief Transpone una hoja [fila, fila + filas) x [columna, columna + columnas) de teselas en teselas.
+ *
+ * Antes de empezar pide para escritura las líneas de destino de toda la hoja. Los bordes
+ * que no completan una tesela se copian elemento a elemento.
+ */
+template <class T>
+void transponerHoja(const std::vector<std::vector<T>>& origen, std::vector<std::vector<T>>& destino, int fila, int columna, int filas, int columnas) {
+    constexpr int LADO = ladoTesela<T>();
+    int filasTeselas = filas / LADO * LADO;
+    int columnasTeselas = columnas / LADO * LADO;
+    const T* filasOrigen[LADO];
+    T* filasDestino[LADO];
+
+    // Cada fila de destino recibe sólo unas líneas de caché por hoja; sin pedirlas antes,
+    // los fallos de escritura se atienden de uno en uno y dominan el tiempo
+    // (un elemento por paso si T ocupa más que una línea)
+    const int porLinea = std::max(1, 64 / static_cast<int>(sizeof(T)));
+    for (int j = 0; j < columnas; j++) {
+        for (int i = 0; i < filas; i += porLinea) {
+            __builtin_prefetch(destino[columna + j].data() + fila + i, 1);
+        }
+    }
+
+    for (int i = 0; i < filasTeselas; i += LADO) {
+        for (int j = 0; j < columnasTeselas; j += LADO) {
+            for (int r = 0; r < LADO; r++) {
+                filasOrigen[r] = origen[fila + i + r].data() + columna + j;
+                filasDestino[r] = destino[columna + j + r].data() + fila + i;
+            }
+            transponerTesela(filasOrigen, filasDestino);
+        }
+    }
+
+    // Bordes: columnas sobrantes de todas las filas y filas sobrantes de las columnas en teselas
+    for (int i = 0; i < filas; i++) {
+        for (int j = columnasTeselas; j < columnas; j++) {
+            destino[columna + j][fila + i] = origen[fila + i][columna + j];
+        }
+    }
+    for (int i = filasTeselas; i < filas; i++) {
+        for (int j = 0; j < columnasTeselas; j++) {
+            destino[columna + j][fila + i] = origen[fila + i][columna + j];
+        }
+    }
+}
+
+/**
+ * @brief Transpuesta recursiva (independiente del tamaño de la caché) de una submatriz.
+ *
+ * Divide por la mitad la dimensión mayor hasta llegar a hojas de HOJA_TRANSPUESTA de
+ * lado, de modo que en algún nivel de la recursión el origen y el destino caben en
+ * cada nivel de caché. Los cortes se redondean a teselas completas.
+ */
+template <class T>
+void transponerRecursivo(const std::vector<std::vector<T>>& origen, std::vector<std::vector<T>>& destino, int fila, int columna, int filas, int columnas) {
+    constexpr int LADO = ladoTesela<T>();
+    if (filas <= HOJA_TRANSPUESTA && columnas <= HOJA_TRANSPUESTA) {
+        transponerHoja(origen, destino, fila, columna, filas, columnas);
+        return;
+    }
+
+    if (filas >= columnas) {
+        int mitad = std::max(LADO, filas / 2 / LADO * LADO);
+        transponerRecursivo(origen, destino, fila, columna, mitad, columnas);
+        transponerRecursivo(origen, destino, fila + mitad, columna, filas - mitad, columnas);
+    } else {
+        int mitad = std::max(LADO, columnas / 2 / LADO * LADO);
+        transponerRecursivo(origen, destino, fila, columna, filas, mitad);
+        transponerRecursivo(origen, destino, fila, columna + mitad, filas, columnas - mitad);
+    }
+}
+
+/**
+ * @brief Transpone 'origen' en 'destino' (fuera de sitio).
+ *
+ * 'destino' se redimensiona a columnas x filas reutilizando la memoria que ya tuviera.
+ *
+ * @param origen Matriz de filas x columnas.
+ * @param destino Matriz transpuesta (columnas x filas).
+ */
+template <class T>
+void transponerEn(const std::vector<std::vector<T>>& origen, std::vector<std::vector<T>>& destino) {
+    int filas = origen.size();
+    int columnas = origen.empty() ? 0 : origen[0].size();
+    destino.resize(columnas);
+    for (auto& fila : destino) {
+        fila.resize(filas);
+    }
+    transponerRecursivo(origen, destino, 0, 0, filas, columnas);
+}
+
+/**
+ * @brief Devuelve la transpuesta de una matriz.
+ */
+template <class T>
+std::vector<std::vector<T>> transponer(const std::vector<std::vector<T>>& origen) {
+    std::vector<std::vector<T>> destino;
+    transponerEn(origen, destino);
+    return destino;
+}
+
+/**
+ * @brief Transpuesta con el doble bucle directo: destino[j][i] = origen[i][j].
+ *
+ * Cada escritura cae en una fila distinta del destino; se conserva como referencia.
+ */
+template <class T>
+void transponerIngenua(const std::vector<std::vector<T>>& origen, std::vector<std::vector<T>>& destino) {
+    int filas = origen.size();
+    int columnas = origen.empty() ? 0 : origen[0].size();
+    destino.resize(columnas);
+    for (auto& fila : destino) {
+        fila.resize(filas);
+    }
+    for (int i = 0; i < filas; i++) {
+        for (int j = 0; j < columnas; j++) {
+            destino[j][i] = origen[i][j];
+        }
+    }
+}
+
+/**
+ * @brief Intercambia la tesela (i, j) con la traspuesta de la (j, i); con i == j, transpone la tesela.
+ */
+template <class T>
+void intercambiarTeselas(std::vector<std::vector<T>>& matriz, int i, int j) {
+    constexpr int LADO = ladoTesela<T>();
+    T copiaA[LADO][LADO], copiaB[LADO][LADO];
+    const T* filasA[LADO];
+    const T* filasB[LADO];
+    T* filasCopiaA[LADO];
+    T* filasCopiaB[LADO];
+
+    // Se transponen ambas a copias locales y después se escriben cruzadas
+    for (int r = 0; r < LADO; r++) {
+        filasA[r] = matriz[i + r].data() + j;
+        filasB[r] = matriz[j + r].data() + i;
+        filasCopiaA[r] = copiaA[r];
+        filasCopiaB[r] = copiaB[r];
+    }
+    transponerTesela(filasA, filasCopiaA);
+    if (i != j) {
+        transponerTesela(filasB, filasCopiaB);
+    }
+    for (int r = 0; r < LADO; r++) {
+        std::copy(copiaA[r], copiaA[r] + LADO, matriz[j + r].data() + i);
+        if (i != j) {
+            std::copy(copiaB[r], copiaB[r] + LADO, matriz[i + r].data() + j);
+        }
+    }
+}
+
+/**
+ * @brief Transpone en sitio una matriz cuadrada.
+ *
+ * Recorre pares de bloques (I, J) con I <= J de BLOQUE_EN_SITIO de lado para que ambos
+ * quepan en la caché, y dentro de ellos intercambia teselas transpuestas en registros.
+ *
+ * @param matriz Matriz n x n; si no es cuadrada no se modifica.
+ * @return bool false si la matriz no es cuadrada.
+ */
+template <class T>
+bool transponerCuadradaEnSitio(std::vector<std::vector<T>>& matriz) {
+    constexpr int LADO = ladoTesela<T>();
+    int n = matriz.size();
+    for (const auto& fila : matriz) {
+        if (static_cast<int>(fila.size()) != n) {
+            return false;
+        }
+    }
+    int nTeselas = n / LADO * LADO;
+
+    for (int bi = 0; bi < nTeselas; bi += BLOQUE_EN_SITIO) {
+        for (int bj = bi; bj < nTeselas; bj += BLOQUE_EN_SITIO) {
+            int finI = std::min(nTeselas, bi + BLOQUE_EN_SITIO);
+            int finJ = std::min(nTeselas, bj + BLOQUE_EN_SITIO);
+            for (int i = bi; i < finI; i += LADO) {
+                for (int j = (bi == bj ? i : bj); j < finJ; j += LADO) {
+                    intercambiarTeselas(matriz, i, j);
+                }
+            }
+        }
+    }
+
+    // Bordes que no completan una tesela
+    for (int i = 0; i < n; i++) {
+        for (int j = std::max(i + 1, nTeselas); j < n; j++) {
+            std::swap(matriz[i][j], matriz[j][i]);
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Transpone en sitio una matriz guardada por filas en un único vector.
+ *
+ * Si es cuadrada intercambia elementos simétricos. Si es rectangular sigue los ciclos de
+ * la permutación: el elemento de la posición p (0 < p < N - 1) pasa a p·filas mod (N - 1).
+ * Cada ciclo se recorre una vez, marcando sus posiciones en un vector de bits (un bit
+ * por elemento, frente a la copia completa de la transpuesta fuera de sitio).
+ *
+ * @param datos Elementos de la matriz por filas; al volver, los de la transpuesta por filas.
+ * @param filas Número de filas antes de transponer.
+ * @param columnas Número de columnas antes de transponer.
+ */
+template <class T>
+void transponerEnSitio(std::vector<T>& datos, int filas, int columnas) {
+    size_t total = static_cast<size_t>(filas) * columnas;
+    if (total <= 1 || datos.size() != total) {
+        return;
+    }
+
+    if (filas == columnas) {
+        for (int bi = 0; bi < filas; bi += BLOQUE_EN_SITIO) {
+            for (int bj = bi; bj < filas; bj += BLOQUE_EN_SITIO) {
+                for (int i = bi; i < std::min(filas, bi + BLOQUE_EN_SITIO); i++) {
+                    for (int j = std::max(bj, i + 1); j < std::min(filas, bj + BLOQUE_EN_SITIO); j++) {
+                        std::swap(datos[static_cast<size_t>(i) * filas + j], datos[static_cast<size_t>(j) * filas + i]);
+                    }
+                }
+            }
+        }
+        return;
+    }
+
+    size_t modulo = total - 1;
+    std::vector<bool> visitado(total, false);
+    for (size_t inicio = 1; inicio < modulo; inicio++) {
+        if (visitado[inicio]) {
+            continue;
+        }
+        // Recorrer el ciclo moviendo cada elemento a su destino
+        size_t posicion = inicio;
+        T valor = datos[inicio];
+        do {
+            size_t siguiente = posicion * filas % modulo;
+            std::swap(valor, datos[siguiente]);
+            visitado[siguiente] = true;
+            posicion = siguiente;
+        } while (posicion != inicio);
+    }
+}
+
+#endif
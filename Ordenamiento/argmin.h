@@ -0,0 +1,214 @@
+#ifndef ARGMIN_H
+#define ARGMIN_H
+
+#include <cstddef>
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+// Reducciones de mínimo y máximo sobre arreglos contiguos. Las versiones para int usan SIMD
+// según lo que permita la compilación (AVX-512, AVX2 o SSE2; con -march=native se elige la
+// más ancha) y las demás, un recorrido escalar.
+
+const std::size_t BLOQUE_ARGMIN = std::size_t(1) << 30;  // Elementos por pasada: los índices de cada carril son de 32 bits
+
+/**
+ * @brief Posición del primer mínimo de datos[0..n) para cualquier tipo con operator<.
+ *
+ * @return std::size_t Índice del primer elemento mínimo, o 0 si n == 0.
+ */
+template <class T>
+std::size_t posicionMinimo(const T* datos, std::size_t n) {
+    std::size_t posicion = 0;
+    for (std::size_t i = 1; i < n; i++) {
+        if (datos[i] < datos[posicion]) {
+            posicion = i;
+        }
+    }
+    return posicion;
+}
+
+/**
+ * @brief Argmin de un bloque de menos de 2^31 enteros con SIMD; cada carril guarda su mínimo y el índice donde lo vio.
+ *
+ * Los carriles sólo se actualizan con un valor estrictamente menor, así que cada uno
+ * conserva el primer índice de su mínimo; al final gana el menor índice entre los
+ * carriles que tienen el mínimo global, y la cola se recorre con la misma regla.
+ */
+inline std::size_t posicionMinimoBloque(const int* datos, std::size_t n) {
+    std::size_t i = 0;
+    int minimo = datos[0];
+    std::size_t posicion = 0;
+
+#if defined(__AVX512F__)
+    if (n >= 16) {
+        __m512i minimos = _mm512_loadu_si512(datos);
+        __m512i actual = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+        __m512i indices = actual;
+        const __m512i paso = _mm512_set1_epi32(16);
+        for (i = 16; i + 16 <= n; i += 16) {
+            actual = _mm512_add_epi32(actual, paso);
+            __m512i valores = _mm512_loadu_si512(datos + i);
+            __mmask16 menores = _mm512_cmplt_epi32_mask(valores, minimos);
+            minimos = _mm512_mask_mov_epi32(minimos, menores, valores);
+            indices = _mm512_mask_mov_epi32(indices, menores, actual);
+        }
+        // Reducción a mano: _mm512_reduce_min_epi32 da -Wmaybe-uninitialized en GCC 12
+        alignas(64) int valoresCarril[16];
+        alignas(64) int indicesCarril[16];
+        _mm512_store_si512(valoresCarril, minimos);
+        _mm512_store_si512(indicesCarril, indices);
+        minimo = valoresCarril[0];
+        posicion = indicesCarril[0];
+        for (int c = 1; c < 16; c++) {
+            if (valoresCarril[c] < minimo || (valoresCarril[c] == minimo && static_cast<std::size_t>(indicesCarril[c]) < posicion)) {
+                minimo = valoresCarril[c];
+                posicion = indicesCarril[c];
+            }
+        }
+    }
+#elif defined(__AVX2__)
+    if (n >= 8) {
+        __m256i minimos = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(datos));
+        __m256i actual = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+        __m256i indices = actual;
+        const __m256i paso = _mm256_set1_epi32(8);
+        for (i = 8; i + 8 <= n; i += 8) {
+            actual = _mm256_add_epi32(actual, paso);
+            __m256i valores = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(datos + i));
+            __m256i menores = _mm256_cmpgt_epi32(minimos, valores);
+            minimos = _mm256_min_epi32(minimos, valores);
+            indices = _mm256_blendv_epi8(indices, actual, menores);
+        }
+        alignas(32) int valoresCarril[8];
+        alignas(32) int indicesCarril[8];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(valoresCarril), minimos);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(indicesCarril), indices);
+        minimo = valoresCarril[0];
+        posicion = indicesCarril[0];
+        for (int c = 1; c < 8; c++) {
+            if (valoresCarril[c] < minimo || (valoresCarril[c] == minimo && static_cast<std::size_t>(indicesCarril[c]) < posicion)) {
+                minimo = valoresCarril[c];
+                posicion = indicesCarril[c];
+            }
+        }
+    }
+#elif defined(__SSE2__)
+    if (n >= 4) {
+        // SSE2 no tiene mínimo ni mezcla de enteros de 32 bits: se hacen con máscaras
+        __m128i minimos = _mm_loadu_si128(reinterpret_cast<const __m128i*>(datos));
+        __m128i actual = _mm_setr_epi32(0, 1, 2, 3);
+        __m128i indices = actual;
+        const __m128i paso = _mm_set1_epi32(4);
+        for (i = 4; i + 4 <= n; i += 4) {
+            actual = _mm_add_epi32(actual, paso);
+            __m128i valores = _mm_loadu_si128(reinterpret_cast<const __m128i*>(datos + i));
+            __m128i menores = _mm_cmpgt_epi32(minimos, valores);
+            minimos = _mm_or_si128(_mm_and_si128(menores, valores), _mm_andnot_si128(menores, minimos));
+            indices = _mm_or_si128(_mm_and_si128(menores, actual), _mm_andnot_si128(menores, indices));
+        }
+        alignas(16) int valoresCarril[4];
+        alignas(16) int indicesCarril[4];
+        _mm_store_si128(reinterpret_cast<__m128i*>(valoresCarril), minimos);
+        _mm_store_si128(reinterpret_cast<__m128i*>(indicesCarril), indices);
+        minimo = valoresCarril[0];
+        posicion = indicesCarril[0];
+        for (int c = 1; c < 4; c++) {
+            if (valoresCarril[c] < minimo || (valoresCarril[c] == minimo && static_cast<std::size_t>(indicesCarril[c]) < posicion)) {
+                minimo = valoresCarril[c];
+                posicion = indicesCarril[c];
+            }
+        }
+    }
+#endif
+
+    for (; i < n; i++) {
+        if (datos[i] < minimo) {
+            minimo = datos[i];
+            posicion = i;
+        }
+    }
+    return posicion;
+}
+
+/**
+ * @brief Posición del primer mínimo de datos[0..n) con SIMD.
+ *
+ * Los arreglos de 2^30 o más elementos se recorren por bloques para que los índices de
+ * los carriles no desborden; entre bloques sólo un mínimo estrictamente menor cambia la posición.
+ *
+ * @return std::size_t Índice del primer elemento mínimo, o 0 si n == 0.
+ */
+inline std::size_t posicionMinimo(const int* datos, std::size_t n) {
+    if (n == 0) {
+        return 0;
+    }
+    std::size_t posicion = posicionMinimoBloque(datos, std::min(n, BLOQUE_ARGMIN));
+    for (std::size_t inicio = BLOQUE_ARGMIN; inicio < n; inicio += BLOQUE_ARGMIN) {
+        std::size_t candidato = inicio + posicionMinimoBloque(datos + inicio, std::min(n - inicio, BLOQUE_ARGMIN));
+        if (datos[candidato] < datos[posicion]) {
+            posicion = candidato;
+        }
+    }
+    return posicion;
+}
+
+/**
+ * @brief Mínimo y máximo de datos[0..n) con SIMD, en una sola pasada.
+ *
+ * @return bool false si n == 0 (minimo y maximo no se modifican).
+ */
+inline bool minimoMaximo(const int* datos, std::size_t n, int& minimo, int& maximo) {
+    if (n == 0) {
+        return false;
+    }
+    std::size_t i = 0;
+    minimo = datos[0];
+    maximo = datos[0];
+
+#if defined(__AVX2__)
+    if (n >= 8) {
+        __m256i minimos = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(datos));
+        __m256i maximos = minimos;
+        for (i = 8; i + 8 <= n; i += 8) {
+            __m256i valores = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(datos + i));
+            minimos = _mm256_min_epi32(minimos, valores);
+            maximos = _mm256_max_epi32(maximos, valores);
+        }
+        alignas(32) int carrilMinimo[8];
+        alignas(32) int carrilMaximo[8];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(carrilMinimo), minimos);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(carrilMaximo), maximos);
+        minimo = *std::min_element(carrilMinimo, carrilMinimo + 8);
+        maximo = *std::max_element(carrilMaximo, carrilMaximo + 8);
+    }
+#elif defined(__SSE2__)
+    if (n >= 4) {
+        __m128i minimos = _mm_loadu_si128(reinterpret_cast<const __m128i*>(datos));
+        __m128i maximos = minimos;
+        for (i = 4; i + 4 <= n; i += 4) {
+            __m128i valores = _mm_loadu_si128(reinterpret_cast<const __m128i*>(datos + i));
+            __m128i menores = _mm_cmpgt_epi32(minimos, valores);
+            __m128i mayores = _mm_cmpgt_epi32(valores, maximos);
+            minimos = _mm_or_si128(_mm_and_si128(menores, valores), _mm_andnot_si128(menores, minimos));
+            maximos = _mm_or_si128(_mm_and_si128(mayores, valores), _mm_andnot_si128(mayores, maximos));
+        }
+        alignas(16) int carrilMinimo[4];
+        alignas(16) int carrilMaximo[4];
+        _mm_store_si128(reinterpret_cast<__m128i*>(carrilMinimo), minimos);
+        _mm_store_si128(reinterpret_cast<__m128i*>(carrilMaximo), maximos);
+        minimo = *std::min_element(carrilMinimo, carrilMinimo + 4);
+        maximo = *std::max_element(carrilMaximo, carrilMaximo + 4);
+    }
+#endif
+
+    for (; i < n; i++) {
+        minimo = std::min(minimo, datos[i]);
+        maximo = std::max(maximo, datos[i]);
+    }
+    return true;
+}
+
+#endif
@@ -0,0 +1,352 @@
+#ifndef ORDENAMIENTO_H
+#define ORDENAMIENTO_H
+
+#include <vector>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <cstdlib>
+#include <cstddef>
+#include <type_traits>
+#include "argmin.h"
+
+/**
+ * @brief Proyección identidad: usa el propio elemento como clave de ordenamiento.
+ */
+struct Identidad {
+    template <class T>
+    constexpr T&& operator()(T&& valor) const noexcept {
+        return std::forward<T>(valor);
+    }
+};
+
+/**
+ * @brief Compara dos elementos a través de sus claves proyectadas.
+ *
+ * El comparador y la proyección son parámetros de plantilla, por lo que la llamada
+ * se resuelve en tiempo de compilación y el compilador la puede expandir en línea.
+ */
+template <class Comp, class Proj, class A, class B>
+inline bool compararClaves(Comp& comp, Proj& proj, A&& a, B&& b) {
+    return std::invoke(comp, std::invoke(proj, std::forward<A>(a)), std::invoke(proj, std::forward<B>(b)));
+}
+
+/**
+ * @brief Selection Sort genérico sobre un rango de iteradores.
+ *
+ * Realiza exactamente un intercambio por posición, igual que la versión para vector<int>.
+ *
+ * @param primero Iterador al primer elemento del rango.
+ * @param ultimo Iterador una posición después del último elemento.
+ * @param comp Comparador estricto entre claves (por defecto std::less<>).
+ * @param proj Proyección que obtiene la clave de cada elemento (por defecto Identidad).
+ */
+template <class It, class Comp = std::less<>, class Proj = Identidad>
+void seleccion(It primero, It ultimo, Comp comp = {}, Proj proj = {}) {
+    for (It i = primero; i != ultimo; ++i) {
+        It minimo = i;
+
+        // Buscar el elemento mínimo en el rango no ordenado
+        for (It j = std::next(i); j != ultimo; ++j) {
+            if (compararClaves(comp, proj, *j, *minimo)) {
+                minimo = j;
+            }
+        }
+
+        // Intercambiar el mínimo encontrado con el primer elemento
+        std::iter_swap(i, minimo);
+    }
+}
+
+/**
+ * @brief Selection Sort sobre un arreglo contiguo que busca cada mínimo con posicionMinimo.
+ *
+ * Para int la búsqueda usa el argmin vectorizado de argmin.h; como devuelve la primera
+ * posición del mínimo, los intercambios son los mismos que los de seleccion.
+ *
+ * @param primero Puntero al primer elemento.
+ * @param ultimo Puntero una posición después del último elemento.
+ */
+template <class T>
+void seleccionVectorizada(T* primero, T* ultimo) {
+    const std::size_t n = static_cast<std::size_t>(ultimo - primero);
+    for (std::size_t i = 0; i < n; i++) {
+        std::size_t minimo = i + posicionMinimo(primero + i, n - i);
+        std::swap(primero[i], primero[minimo]);
+    }
+}
+
+/**
+ * @brief Selection Sort con un árbol de torneo: O(n log n) comparaciones y un intercambio por posición.
+ *
+ * Las hojas del árbol son las posiciones del rango y cada nodo interno guarda la posición
+ * ganadora de su subárbol. En un empate gana la hoja izquierda (la posición menor), así que
+ * el ganador es siempre el primer mínimo del sufijo y los intercambios coinciden uno a uno
+ * con los de seleccion. Tras cada intercambio sólo se rejuegan los caminos de las dos hojas
+ * que cambiaron. Requiere iteradores de acceso aleatorio.
+ *
+ * @param primero Iterador al primer elemento del rango.
+ * @param ultimo Iterador una posición después del último elemento.
+ * @param comp Comparador estricto entre claves (por defecto std::less<>).
+ * @param proj Proyección que obtiene la clave de cada elemento (por defecto Identidad).
+ */
+template <class It, class Comp = std::less<>, class Proj = Identidad>
+void seleccionPorTorneo(It primero, It ultimo, Comp comp = {}, Proj proj = {}) {
+    const std::size_t n = static_cast<std::size_t>(std::distance(primero, ultimo));
+    if (n < 2) {
+        return;
+    }
+
+    std::size_t hojas = 1;
+    while (hojas < n) {
+        hojas *= 2;
+    }
+    const std::size_t NADIE = n;  // Hoja vacía o posición ya ordenada
+    std::vector<std::size_t> arbol(2 * hojas, NADIE);
+
+    // Todas las posiciones del subárbol izquierdo son menores que las del derecho
+    auto ganador = [&](std::size_t izquierda, std::size_t derecha) {
+        if (derecha == NADIE) {
+            return izquierda;
+        }
+        if (izquierda == NADIE || compararClaves(comp, proj, primero[derecha], primero[izquierda])) {
+            return derecha;
+        }
+        return izquierda;
+    };
+    auto rejugar = [&](std::size_t hoja) {
+        for (std::size_t nodo = (hojas + hoja) / 2; nodo >= 1; nodo /= 2) {
+            arbol[nodo] = ganador(arbol[2 * nodo], arbol[2 * nodo + 1]);
+        }
+    };
+
+    for (std::size_t i = 0; i < n; i++) {
+        arbol[hojas + i] = i;
+    }
+    for (std::size_t nodo = hojas - 1; nodo >= 1; nodo--) {
+        arbol[nodo] = ganador(arbol[2 * nodo], arbol[2 * nodo + 1]);
+    }
+
+    for (std::size_t i = 0; i + 1 < n; i++) {
+        std::size_t minimo = arbol[1];
+        std::iter_swap(primero + i, primero + minimo);
+
+        // La posición i sale del torneo y en 'minimo' quedó el antiguo valor de i
+        arbol[hojas + i] = NADIE;
+        rejugar(i);
+        if (minimo != i) {
+            rejugar(minimo);
+        }
+    }
+}
+
+/**
+ * @brief Mezcla dos subrangos ordenados consecutivos usando un búfer auxiliar.
+ *
+ * Se copia sólo la mitad izquierda al búfer; la mezcla es estable.
+ *
+ * @param primero Inicio de la primera mitad.
+ * @param medio Inicio de la segunda mitad.
+ * @param ultimo Fin de la segunda mitad.
+ * @param auxiliar Búfer reutilizado entre llamadas (se redimensiona si hace falta).
+ */
+template <class It, class Comp, class Proj, class Valor>
+void mezclar(It primero, It medio, It ultimo, Comp& comp, Proj& proj, std::vector<Valor>& auxiliar) {
+    auxiliar.assign(std::make_move_iterator(primero), std::make_move_iterator(medio));
+
+    auto izquierda = auxiliar.begin();
+    auto finIzquierda = auxiliar.end();
+    It derecha = medio;
+    It destino = primero;
+
+    // Mezclar tomando de la izquierda en caso de empate para mantener la estabilidad
+    while (izquierda != finIzquierda && derecha != ultimo) {
+        if (compararClaves(comp, proj, *derecha, *izquierda)) {
+            *destino++ = std::move(*derecha++);
+        } else {
+            *destino++ = std::move(*izquierda++);
+        }
+    }
+
+    // Copiar los elementos restantes de la izquierda (los de la derecha ya están en su lugar)
+    std::move(izquierda, finIzquierda, destino);
+}
+
+/**
+ * @brief Paso recursivo de Merge Sort que comparte el búfer auxiliar.
+ */
+template <class It, class Comp, class Proj, class Valor>
+void mergeSortRecursivo(It primero, It ultimo, Comp& comp, Proj& proj, std::vector<Valor>& auxiliar) {
+    auto n = std::distance(primero, ultimo);
+    if (n < 2) {
+        return;
+    }
+
+    It medio = std::next(primero, n / 2);
+
+    // Ordenar las dos mitades
+    mergeSortRecursivo(primero, medio, comp, proj, auxiliar);
+    mergeSortRecursivo(medio, ultimo, comp, proj, auxiliar);
+
+    // Mezclar las mitades ordenadas
+    mezclar(primero, medio, ultimo, comp, proj, auxiliar);
+}
+
+/**
+ * @brief Merge Sort genérico y estable sobre un rango de iteradores.
+ *
+ * Reserva un único búfer auxiliar de n/2 elementos en lugar de dos vectores por mezcla.
+ *
+ * @param primero Iterador al primer elemento del rango.
+ * @param ultimo Iterador una posición después del último elemento.
+ * @param comp Comparador estricto entre claves (por defecto std::less<>).
+ * @param proj Proyección que obtiene la clave de cada elemento (por defecto Identidad).
+ */
+template <class It, class Comp = std::less<>, class Proj = Identidad>
+void mergeSort(It primero, It ultimo, Comp comp = {}, Proj proj = {}) {
+    using Valor = typename std::iterator_traits<It>::value_type;
+    std::vector<Valor> auxiliar;
+    auxiliar.reserve(static_cast<std::size_t>(std::distance(primero, ultimo)) / 2 + 1);
+    mergeSortRecursivo(primero, ultimo, comp, proj, auxiliar);
+}
+
+/**
+ * @brief Partición de Lomuto con pivote aleatorio sobre un rango no vacío.
+ *
+ * @param primero Iterador al primer elemento del rango.
+ * @param ultimo Iterador una posición después del último elemento.
+ * @return It Posición final del pivote: a su izquierda quedan los elementos menores.
+ */
+template <class It, class Comp = std::less<>, class Proj = Identidad>
+It particion(It primero, It ultimo, Comp comp = {}, Proj proj = {}) {
+    // Elegir un pivote aleatorio para evitar el peor caso en listas ordenadas
+    auto n = std::distance(primero, ultimo);
+    It alto = std::prev(ultimo);
+    std::iter_swap(std::next(primero, rand() % n), alto);  // Mover el pivote al final
+
+    // Copiar la clave del pivote para que el compilador la mantenga en un registro
+    const std::decay_t<decltype(std::invoke(proj, *alto))> clavePivote = std::invoke(proj, *alto);
+    It i = primero;
+
+    // Colocar todos los elementos menores que el pivote a la izquierda y los mayores a la derecha
+    for (It j = primero; j != alto; ++j) {
+        if (std::invoke(comp, std::invoke(proj, *j), clavePivote)) {
+            std::iter_swap(i, j);
+            ++i;
+        }
+    }
+    std::iter_swap(i, alto);  // Colocar el pivote en su posición correcta
+    return i;
+}
+
+/**
+ * @brief Quick Sort genérico con pivote aleatorio sobre un rango de iteradores de acceso aleatorio.
+ *
+ * @param primero Iterador al primer elemento del rango.
+ * @param ultimo Iterador una posición después del último elemento.
+ * @param comp Comparador estricto entre claves (por defecto std::less<>).
+ * @param proj Proyección que obtiene la clave de cada elemento (por defecto Identidad).
+ */
+template <class It, class Comp = std::less<>, class Proj = Identidad>
+void quickSort(It primero, It ultimo, Comp comp = {}, Proj proj = {}) {
+    if (std::distance(primero, ultimo) > 1) {
+        // Obtener la posición del pivote después de la partición
+        It pivote = particion(primero, ultimo, comp, proj);
+
+        // Ordenar las partes izquierda y derecha del pivote
+        quickSort(primero, pivote, comp, proj);
+        quickSort(std::next(pivote), ultimo, comp, proj);
+    }
+}
+
+/**
+ * @brief Objetos función que envuelven cada algoritmo para poder pasarlos como parámetro de plantilla.
+ */
+struct OrdenarSeleccion {
+    template <class It, class Comp = std::less<>, class Proj = Identidad>
+    void operator()(It primero, It ultimo, Comp comp = {}, Proj proj = {}) const {
+        seleccion(primero, ultimo, comp, proj);
+    }
+};
+
+struct OrdenarMerge {
+    template <class It, class Comp = std::less<>, class Proj = Identidad>
+    void operator()(It primero, It ultimo, Comp comp = {}, Proj proj = {}) const {
+        mergeSort(primero, ultimo, comp, proj);
+    }
+};
+
+struct OrdenarQuick {
+    template <class It, class Comp = std::less<>, class Proj = Identidad>
+    void operator()(It primero, It ultimo, Comp comp = {}, Proj proj = {}) const {
+        quickSort(primero, ultimo, comp, proj);
+    }
+};
+
+/**
+ * @brief Reordena un rango según una permutación, moviendo cada elemento una sola vez.
+ *
+ * Sigue los ciclos de la permutación; sólo se necesita un elemento temporal por ciclo.
+ *
+ * @param primero Iterador al primer elemento del rango.
+ * @param origen origen[i] es la posición actual del elemento que debe quedar en i. Se consume.
+ */
+template <class It>
+void aplicarPermutacion(It primero, std::vector<std::size_t>& origen) {
+    const std::size_t n = origen.size();
+
+    for (std::size_t inicio = 0; inicio < n; inicio++) {
+        if (origen[inicio] == inicio) {
+            continue;
+        }
+
+        // Recorrer el ciclo que empieza en 'inicio'
+        auto temporal = std::move(primero[inicio]);
+        std::size_t actual = inicio;
+        while (origen[actual] != inicio) {
+            std::size_t siguiente = origen[actual];
+            primero[actual] = std::move(primero[siguiente]);
+            origen[actual] = actual;  // Marcar la posición como resuelta
+            actual = siguiente;
+        }
+        primero[actual] = std::move(temporal);
+        origen[actual] = actual;
+    }
+}
+
+/**
+ * @brief Ordena registros grandes ordenando pares (clave, índice) y permutando una sola vez.
+ *
+ * El bucle interno del algoritmo sólo mueve claves compactas; la carga útil de cada
+ * registro se mueve una única vez al final. Conviene cuando sizeof(registro) es
+ * bastante mayor que sizeof(clave) + sizeof(size_t).
+ *
+ * @param primero Iterador de acceso aleatorio al primer registro.
+ * @param ultimo Iterador una posición después del último registro.
+ * @param comp Comparador estricto entre claves.
+ * @param proj Proyección que extrae la clave de cada registro (p. ej. &Registro::clave).
+ * @param ordenar Algoritmo a utilizar (OrdenarQuick, OrdenarMerge u OrdenarSeleccion).
+ */
+template <class It, class Comp = std::less<>, class Proj = Identidad, class Ordenador = OrdenarQuick>
+void ordenarPorClave(It primero, It ultimo, Comp comp = {}, Proj proj = {}, Ordenador ordenar = {}) {
+    using Registro = typename std::iterator_traits<It>::value_type;
+    using Clave = std::decay_t<std::invoke_result_t<Proj&, const Registro&>>;
+
+    const std::size_t n = static_cast<std::size_t>(std::distance(primero, ultimo));
+    std::vector<std::pair<Clave, std::size_t>> claves;
+    claves.reserve(n);
+    for (std::size_t i = 0; i < n; i++) {
+        claves.emplace_back(std::invoke(proj, primero[i]), i);
+    }
+
+    // Ordenar sólo los pares compactos; el comparador se aplica a la clave del par
+    ordenar(claves.begin(), claves.end(), comp, &std::pair<Clave, std::size_t>::first);
+
+    std::vector<std::size_t> origen(n);
+    for (std::size_t i = 0; i < n; i++) {
+        origen[i] = claves[i].second;
+    }
+    aplicarPermutacion(primero, origen);
+}
+
+#endif
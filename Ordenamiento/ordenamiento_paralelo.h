@@ -0,0 +1,124 @@
+#ifndef ORDENAMIENTO_PARALELO_H
+#define ORDENAMIENTO_PARALELO_H
+
+#include <vector>
+#include <algorithm>
+#include <utility>
+#include <cstddef>
+#include "ordenamiento.h"
+#include "../Data_sets/memoria_numa.h"
+
+// Merge Sort paralelo sobre un BufferGrande. Cada trabajador ordena su parte y después,
+// en cada ronda de mezcla, escribe siempre el mismo rango del destino: el que inicializó
+// con el primer toque. Los puntos de corte de cada mezcla se buscan por bisección, así
+// que ningún trabajador espera a otro dentro de una ronda.
+
+/**
+ * @brief Cuántos de los k primeros elementos de la mezcla estable de a y b vienen de a.
+ *
+ * @param a Primer rango ordenado (m elementos); gana los empates.
+ * @param b Segundo rango ordenado (n elementos).
+ * @param k Posición en la mezcla, entre 0 y m + n.
+ */
+template <class T>
+std::size_t corteMezcla(const T* a, std::size_t m, const T* b, std::size_t n, std::size_t k) {
+    std::size_t bajo = k > n ? k - n : 0;
+    std::size_t alto = std::min(k, m);
+    while (bajo < alto) {
+        std::size_t i = bajo + (alto - bajo) / 2;
+        // a[i] está entre los k primeros si no es mayor que b[k - i - 1]
+        if (!(b[k - i - 1] < a[i])) {
+            bajo = i + 1;
+        } else {
+            alto = i;
+        }
+    }
+    return bajo;
+}
+
+/**
+ * @brief Escribe destino[primero, ultimo) de la mezcla de las corridas [inicio, medio) y [medio, fin) de origen.
+ */
+template <class T>
+void mezclarTramo(const T* origen, T* destino, std::size_t inicio, std::size_t medio, std::size_t fin, std::size_t primero, std::size_t ultimo) {
+    const T* a = origen + inicio;
+    const T* b = origen + medio;
+    std::size_t m = medio - inicio;
+    std::size_t n = fin - medio;
+    std::size_t desdeA = corteMezcla(a, m, b, n, primero - inicio);
+    std::size_t hastaA = corteMezcla(a, m, b, n, ultimo - inicio);
+    std::size_t desdeB = primero - inicio - desdeA;
+    std::size_t hastaB = ultimo - inicio - hastaA;
+    std::merge(a + desdeA, a + hastaA, b + desdeB, b + hastaB, destino + primero);
+}
+
+/**
+ * @brief Ordena un BufferGrande con los trabajadores del grupo.
+ *
+ * El trabajador h ordena con mergeSort la parte h de rangoHilo (la que copiarABufferGrande
+ * le hizo inicializar) y las corridas se mezclan por pares en ceil(log2(hilos)) rondas,
+ * alternando entre los datos y un auxiliar del mismo tipo de páginas.
+ *
+ * @param datos Buffer que se ordena en sitio.
+ * @param grupo Trabajadores.
+ * @param configuracion Páginas del auxiliar y si se inicializa con el primer toque.
+ */
+template <class T>
+void ordenarParalelo(BufferGrande<T>& datos, GrupoHilos& grupo, const ConfiguracionNuma& configuracion) {
+    std::size_t n = datos.size();
+    int hilos = grupo.cantidad();
+    BufferGrande<T> auxiliar(n, configuracion.paginas);
+    if (!configuracion.primerToque) {
+        std::fill(auxiliar.begin(), auxiliar.end(), T());
+    }
+
+    std::vector<std::size_t> limites;
+    for (int h = 0; h < hilos; h++) {
+        limites.push_back(rangoHilo(n, h, hilos).first);
+    }
+    limites.push_back(n);
+
+    grupo.ejecutar([&](int h, int hilos) {
+        std::pair<std::size_t, std::size_t> rango = rangoHilo(n, h, hilos);
+        if (configuracion.primerToque) {
+            std::fill(auxiliar.data() + rango.first, auxiliar.data() + rango.second, T());
+        }
+        mergeSort(datos.data() + rango.first, datos.data() + rango.second);
+    });
+
+    T* origen = datos.data();
+    T* destino = auxiliar.data();
+    while (limites.size() > 2) {
+        grupo.ejecutar([&](int h, int hilos) {
+            std::pair<std::size_t, std::size_t> rango = rangoHilo(n, h, hilos);
+            for (std::size_t p = 0; p + 1 < limites.size(); p += 2) {
+                std::size_t inicio = limites[p];
+                std::size_t medio = limites[p + 1];
+                std::size_t fin = p + 2 < limites.size() ? limites[p + 2] : medio;
+                std::size_t primero = std::max(rango.first, inicio);
+                std::size_t ultimo = std::min(rango.second, fin);
+                if (primero < ultimo) {
+                    mezclarTramo(origen, destino, inicio, medio, fin, primero, ultimo);
+                }
+            }
+        });
+        std::vector<std::size_t> siguientes;
+        for (std::size_t p = 0; p < limites.size(); p += 2) {
+            siguientes.push_back(limites[p]);
+        }
+        if (siguientes.back() != n) {
+            siguientes.push_back(n);
+        }
+        limites = std::move(siguientes);
+        std::swap(origen, destino);
+    }
+
+    if (origen != datos.data()) {
+        grupo.ejecutar([&](int h, int hilos) {
+            std::pair<std::size_t, std::size_t> rango = rangoHilo(n, h, hilos);
+            std::copy(origen + rango.first, origen + rango.second, datos.data() + rango.first);
+        });
+    }
+}
+
+#endif
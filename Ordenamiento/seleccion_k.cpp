@@ -0,0 +1,31 @@
+#include <iostream>
+#include <vector>
+#include <cstdlib>
+#include <ctime>
+#include "seleccion_k.h"
+#include "../Benchmark/benchmark.h"
+#include "../Benchmark/algoritmos.h"
+
+using namespace std;
+
+/**
+ * @brief Función principal que compara la selección de k-ésimo elemento y top-k con la biblioteca estándar.
+ *
+ * @return int Código de estado de la ejecución.
+ */
+int main(int argc, char* argv[]) {
+    // Semilla para la función rand() usada por la partición
+    srand(time(0));
+
+    RegistroBenchmark registro;
+    registrarAlgoritmosSeleccion(registro);
+
+    // Datasets a leer
+    for (const string& archivo : archivosOrdenamiento()) {
+        registro.agregarDatasetOrdenamiento(archivo);
+    }
+    agregarTopKEnFlujo(registro, archivosOrdenamiento());
+
+    // Cada resultado se verifica fuera de la medición
+    return ejecutarBenchmark(registro, argc, argv);
+}
@@ -0,0 +1,272 @@
+#ifndef SELECCION_K_H
+#define SELECCION_K_H
+
+#include <vector>
+#include <functional>
+#include <iterator>
+#include <algorithm>
+#include <utility>
+#include <cmath>
+#include <cstddef>
+#include <fstream>
+#include <string>
+#include "ordenamiento.h"
+
+/**
+ * @brief Ordena por inserción un rango pequeño (usado en las hojas de la selección).
+ */
+template <class It, class Comp, class Proj>
+void insercion(It primero, It ultimo, Comp& comp, Proj& proj) {
+    if (primero == ultimo) {
+        return;
+    }
+    for (It i = std::next(primero); i != ultimo; ++i) {
+        auto valor = std::move(*i);
+        It j = i;
+        while (j != primero && compararClaves(comp, proj, valor, *std::prev(j))) {
+            *j = std::move(*std::prev(j));
+            --j;
+        }
+        *j = std::move(valor);
+    }
+}
+
+/**
+ * @brief Selección por montículo: deja en 'nth' el elemento que le corresponde en orden.
+ *
+ * Es el respaldo O(n log n) garantizado de introselect cuando las particiones degeneran.
+ */
+template <class It, class Comp, class Proj>
+void seleccionPorMonticulo(It primero, It nth, It ultimo, Comp& comp, Proj& proj) {
+    auto menor = [&](const auto& a, const auto& b) { return compararClaves(comp, proj, a, b); };
+    It finMonticulo = std::next(nth);
+
+    // Montículo de máximos con los nth-primero+1 menores vistos hasta ahora
+    std::make_heap(primero, finMonticulo, menor);
+    for (It i = finMonticulo; i != ultimo; ++i) {
+        if (menor(*i, *primero)) {
+            std::pop_heap(primero, finMonticulo, menor);
+            std::iter_swap(std::prev(finMonticulo), i);
+            std::push_heap(primero, finMonticulo, menor);
+        }
+    }
+
+    // La raíz es el mayor de los menores: su lugar es 'nth'
+    std::iter_swap(primero, nth);
+}
+
+/**
+ * @brief Introselect: quickselect sobre la partición de Quick Sort con límite de profundidad.
+ *
+ * Tras 2·log2(n) particiones sin terminar, recurre a la selección por montículo,
+ * de modo que el peor caso queda acotado en O(n log n).
+ *
+ * @param primero Iterador al primer elemento del rango.
+ * @param nth Posición que debe quedar con el elemento que le corresponde en el orden final.
+ * @param ultimo Iterador una posición después del último elemento.
+ */
+template <class It, class Comp = std::less<>, class Proj = Identidad>
+void introselect(It primero, It nth, It ultimo, Comp comp = {}, Proj proj = {}) {
+    if (nth == ultimo) {
+        return;
+    }
+
+    int limite = 2 * static_cast<int>(std::log2(std::max<std::ptrdiff_t>(std::distance(primero, ultimo), 1)));
+
+    while (std::distance(primero, ultimo) > 16) {
+        if (limite-- == 0) {
+            seleccionPorMonticulo(primero, nth, ultimo, comp, proj);
+            return;
+        }
+
+        // Reutilizar la partición con pivote aleatorio de Quick Sort y seguir sólo por el lado de 'nth'
+        It pivote = particion(primero, ultimo, comp, proj);
+        if (pivote == nth) {
+            return;
+        }
+        if (nth < pivote) {
+            ultimo = pivote;
+        } else {
+            primero = std::next(pivote);
+        }
+    }
+
+    insercion(primero, ultimo, comp, proj);
+}
+
+/**
+ * @brief Paso recursivo de Floyd–Rivest sobre índices [izquierda, derecha] (ambos inclusive).
+ */
+template <class It, class Comp, class Proj>
+void floydRivestRecursivo(It datos, std::ptrdiff_t izquierda, std::ptrdiff_t derecha, std::ptrdiff_t k,
+                          Comp& comp, Proj& proj) {
+    while (derecha > izquierda) {
+        // Para rangos grandes, seleccionar primero sobre una muestra que acota el rango de búsqueda
+        if (derecha - izquierda > 600) {
+            double n = static_cast<double>(derecha - izquierda + 1);
+            double i = static_cast<double>(k - izquierda + 1);
+            double z = std::log(n);
+            double s = 0.5 * std::exp(2.0 * z / 3.0);
+            double sd = 0.5 * std::sqrt(z * s * (n - s) / n) * (i - n / 2 < 0 ? -1.0 : 1.0);
+            std::ptrdiff_t nuevaIzquierda = std::max(izquierda, static_cast<std::ptrdiff_t>(std::floor(k - i * s / n + sd)));
+            std::ptrdiff_t nuevaDerecha = std::min(derecha, static_cast<std::ptrdiff_t>(std::floor(k + (n - i) * s / n + sd)));
+            floydRivestRecursivo(datos, nuevaIzquierda, nuevaDerecha, k, comp, proj);
+        }
+
+        // Particionar alrededor del elemento k (que ahora es una buena estimación)
+        const std::decay_t<decltype(std::invoke(proj, datos[k]))> t = std::invoke(proj, datos[k]);
+        std::ptrdiff_t i = izquierda;
+        std::ptrdiff_t j = derecha;
+        std::iter_swap(datos + izquierda, datos + k);
+        if (std::invoke(comp, t, std::invoke(proj, datos[derecha]))) {
+            std::iter_swap(datos + derecha, datos + izquierda);
+        }
+        while (i < j) {
+            std::iter_swap(datos + i, datos + j);
+            i++;
+            j--;
+            while (std::invoke(comp, std::invoke(proj, datos[i]), t)) {
+                i++;
+            }
+            while (std::invoke(comp, t, std::invoke(proj, datos[j]))) {
+                j--;
+            }
+        }
+
+        const auto& claveIzquierda = std::invoke(proj, datos[izquierda]);
+        if (!std::invoke(comp, claveIzquierda, t) && !std::invoke(comp, t, claveIzquierda)) {
+            std::iter_swap(datos + izquierda, datos + j);
+        } else {
+            j++;
+            std::iter_swap(datos + j, datos + derecha);
+        }
+
+        // Ajustar los límites para quedarse con el lado que contiene k
+        if (j <= k) {
+            izquierda = j + 1;
+        }
+        if (k <= j) {
+            derecha = j - 1;
+        }
+    }
+}
+
+/**
+ * @brief Selección de Floyd–Rivest: en promedio n + min(k, n-k) + o(n) comparaciones.
+ *
+ * @param primero Iterador de acceso aleatorio al primer elemento.
+ * @param nth Posición que debe quedar con el elemento que le corresponde en el orden final.
+ * @param ultimo Iterador una posición después del último elemento.
+ */
+template <class It, class Comp = std::less<>, class Proj = Identidad>
+void floydRivest(It primero, It nth, It ultimo, Comp comp = {}, Proj proj = {}) {
+    if (nth == ultimo) {
+        return;
+    }
+    floydRivestRecursivo(primero, 0, std::distance(primero, ultimo) - 1, std::distance(primero, nth), comp, proj);
+}
+
+/**
+ * @brief Equivalente a std::nth_element: Floyd–Rivest para rangos grandes, introselect para pequeños.
+ */
+template <class It, class Comp = std::less<>, class Proj = Identidad>
+void nthElemento(It primero, It nth, It ultimo, Comp comp = {}, Proj proj = {}) {
+    if (std::distance(primero, ultimo) > 600) {
+        floydRivest(primero, nth, ultimo, comp, proj);
+    } else {
+        introselect(primero, nth, ultimo, comp, proj);
+    }
+}
+
+/**
+ * @brief Ordenamiento parcial: deja ordenados en [primero, medio) los menores elementos del rango.
+ *
+ * Es un Quick Sort parcial: tras cada partición sólo se ordena por completo el lado
+ * que cae dentro de [primero, medio); el resto del rango queda sin orden definido.
+ *
+ * @param primero Iterador al primer elemento del rango.
+ * @param medio Fin del prefijo que se quiere ordenado.
+ * @param ultimo Iterador una posición después del último elemento.
+ */
+template <class It, class Comp = std::less<>, class Proj = Identidad>
+void ordenamientoParcial(It primero, It medio, It ultimo, Comp comp = {}, Proj proj = {}) {
+    while (primero < medio && std::distance(primero, ultimo) > 1) {
+        It pivote = particion(primero, ultimo, comp, proj);
+
+        if (pivote < medio) {
+            // Todo lo que está a la izquierda del pivote pertenece al prefijo: ordenarlo entero
+            quickSort(primero, pivote, comp, proj);
+            primero = std::next(pivote);
+        } else {
+            // Sólo interesa la parte izquierda
+            ultimo = pivote;
+        }
+    }
+}
+
+/**
+ * @brief Top-k en flujo: conserva los k menores elementos vistos en un montículo de máximos.
+ *
+ * Usa O(k) memoria y O(log k) por elemento, por lo que sirve para datos que no caben en memoria.
+ */
+template <class T, class Comp = std::less<>, class Proj = Identidad>
+class TopK {
+public:
+    explicit TopK(std::size_t k, Comp comp = {}, Proj proj = {}) : k(k), comp(comp), proj(proj) {
+        monticulo.reserve(k);
+    }
+
+    /**
+     * @brief Procesa un nuevo elemento del flujo.
+     */
+    void agregar(const T& valor) {
+        auto menor = [this](const T& a, const T& b) { return compararClaves(comp, proj, a, b); };
+
+        if (monticulo.size() < k) {
+            monticulo.push_back(valor);
+            std::push_heap(monticulo.begin(), monticulo.end(), menor);
+        } else if (k > 0 && menor(valor, monticulo.front())) {
+            // Reemplazar el mayor de los k menores
+            std::pop_heap(monticulo.begin(), monticulo.end(), menor);
+            monticulo.back() = valor;
+            std::push_heap(monticulo.begin(), monticulo.end(), menor);
+        }
+    }
+
+    /**
+     * @brief Devuelve los k menores elementos vistos, ordenados de menor a mayor.
+     */
+    std::vector<T> resultado() const {
+        auto menor = [this](const T& a, const T& b) { return compararClaves(comp, proj, a, b); };
+        std::vector<T> ordenados = monticulo;
+        std::sort_heap(ordenados.begin(), ordenados.end(), menor);
+        return ordenados;
+    }
+
+private:
+    std::size_t k;
+    Comp comp;
+    Proj proj;
+    std::vector<T> monticulo;
+};
+
+/**
+ * @brief Obtiene los k menores enteros de un archivo de texto leyéndolo en flujo, sin cargarlo entero.
+ *
+ * @param nombreArchivo Nombre del archivo que contiene los datos.
+ * @param k Número de elementos a conservar.
+ * @return std::vector<int> Los k menores elementos, ordenados.
+ */
+inline std::vector<int> topKDesdeArchivo(const std::string& nombreArchivo, std::size_t k) {
+    TopK<int> topK(k);
+    std::ifstream archivo(nombreArchivo);
+    int numero;
+
+    while (archivo >> numero) {
+        topK.agregar(numero);
+    }
+
+    return topK.resultado();
+}
+
+#endif